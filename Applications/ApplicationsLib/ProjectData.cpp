@@ -18,6 +18,10 @@
 
 #include <logog/include/logog.hpp>
 
+#ifdef USE_PETSC
+#include <mpi.h>
+#endif
+
 #ifdef OGS_USE_PYTHON
 #include <pybind11/eval.h>
 #endif
@@ -262,6 +266,18 @@ boost::optional<ParameterLib::CoordinateSystem> parseLocalCoordinateSystem(
     return ParameterLib::CoordinateSystem{basis_vector_0, basis_vector_1,
                                           basis_vector_2};
 }
+
+/// Stops with an error for a process that is not available for the given
+/// global dimension.
+void dimensionNotSupported(std::string const& process_type,
+                           int const dimension)
+{
+    OGS_FATAL(
+        "%s process does not support dimension %d. Processes are only built "
+        "for the global dimensions from OGS_MIN_GLOBAL_DIM to "
+        "OGS_MAX_ELEMENT_DIM.",
+        process_type.c_str(), dimension);
+}
 }  // namespace
 
 ProjectData::ProjectData() = default;
@@ -491,6 +507,25 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
             //! \ogs_file_param{prj__processes__process__integration_order}
             process_config.getConfigParameter<int>("integration_order");
 
+        auto const record_assembly_costs =
+            //! \ogs_file_param{prj__processes__process__record_assembly_costs}
+            process_config.getConfigParameter<bool>("record_assembly_costs",
+                                                    false);
+#ifdef USE_PETSC
+        // With several ranks the costs would be stored under partition-local
+        // element ids, which cannot be mapped back to the serial mesh read by
+        // partmesh. A single rank works on the serial mesh.
+        int world_size;
+        MPI_Comm_size(MPI_COMM_WORLD, &world_size);
+        if (record_assembly_costs && world_size > 1)
+        {
+            OGS_FATAL(
+                "Recording the assembly costs is only supported for runs on "
+                "a single process; record them in a serial run of the same "
+                "model and pass the resulting mesh to partmesh.");
+        }
+#endif
+
         std::unique_ptr<ProcessLib::Process> process;
 
         auto jacobian_assembler = ProcessLib::createJacobianAssembler(
@@ -564,8 +599,11 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
             if (type == "HYDRO_MECHANICS")
         {
             //! \ogs_file_param{prj__processes__process__HYDRO_MECHANICS__dimension}
-            switch (process_config.getConfigParameter<int>("dimension"))
+            auto const dimension =
+                process_config.getConfigParameter<int>("dimension");
+            switch (dimension)
             {
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
                 case 2:
                     process =
                         ProcessLib::HydroMechanics::createHydroMechanicsProcess<
@@ -575,6 +613,8 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
                                _local_coordinate_system, integration_order,
                                process_config);
                     break;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
                 case 3:
                     process =
                         ProcessLib::HydroMechanics::createHydroMechanicsProcess<
@@ -584,10 +624,9 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
                                _local_coordinate_system, integration_order,
                                process_config);
                     break;
+#endif
                 default:
-                    OGS_FATAL(
-                        "HYDRO_MECHANICS process does not support given "
-                        "dimension");
+                    dimensionNotSupported(type, dimension);
             }
         }
         else
@@ -596,8 +635,11 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
             if (type == "HYDRO_MECHANICS_WITH_LIE")
         {
             //! \ogs_file_param{prj__processes__process__HYDRO_MECHANICS_WITH_LIE__dimension}
-            switch (process_config.getConfigParameter<int>("dimension"))
+            auto const dimension =
+                process_config.getConfigParameter<int>("dimension");
+            switch (dimension)
             {
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
                 case 2:
                     process = ProcessLib::LIE::HydroMechanics::
                         createHydroMechanicsProcess<2>(
@@ -606,6 +648,8 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
                             _local_coordinate_system, integration_order,
                             process_config);
                     break;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
                 case 3:
                     process = ProcessLib::LIE::HydroMechanics::
                         createHydroMechanicsProcess<3>(
@@ -614,10 +658,9 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
                             _local_coordinate_system, integration_order,
                             process_config);
                     break;
+#endif
                 default:
-                    OGS_FATAL(
-                        "HYDRO_MECHANICS_WITH_LIE process does not support "
-                        "given dimension");
+                    dimensionNotSupported(type, dimension);
             }
         }
         else
@@ -648,6 +691,7 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
         {
             switch (_mesh_vec[0]->getDimension())
             {
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
                 case 2:
                     process =
                         ProcessLib::PhaseField::createPhaseFieldProcess<2>(
@@ -656,6 +700,8 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
                             _local_coordinate_system, integration_order,
                             process_config);
                     break;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
                 case 3:
                     process =
                         ProcessLib::PhaseField::createPhaseFieldProcess<3>(
@@ -664,6 +710,9 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
                             _local_coordinate_system, integration_order,
                             process_config);
                     break;
+#endif
+                default:
+                    dimensionNotSupported(type, _mesh_vec[0]->getDimension());
             }
         }
         else
@@ -684,6 +733,7 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
         {
             switch (_mesh_vec[0]->getDimension())
             {
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
                 case 2:
                     process = ProcessLib::SmallDeformation::
                         createSmallDeformationProcess<2>(
@@ -692,6 +742,8 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
                             _local_coordinate_system, integration_order,
                             process_config);
                     break;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
                 case 3:
                     process = ProcessLib::SmallDeformation::
                         createSmallDeformationProcess<3>(
@@ -700,10 +752,9 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
                             _local_coordinate_system, integration_order,
                             process_config);
                     break;
+#endif
                 default:
-                    OGS_FATAL(
-                        "SMALL_DEFORMATION process does not support "
-                        "given dimension");
+                    dimensionNotSupported(type, _mesh_vec[0]->getDimension());
             }
         }
         else
@@ -713,6 +764,7 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
         {
             switch (_mesh_vec[0]->getDimension())
             {
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
                 case 2:
                     process = ProcessLib::SmallDeformationNonlocal::
                         createSmallDeformationNonlocalProcess<2>(
@@ -721,6 +773,8 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
                             _local_coordinate_system, integration_order,
                             process_config);
                     break;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
                 case 3:
                     process = ProcessLib::SmallDeformationNonlocal::
                         createSmallDeformationNonlocalProcess<3>(
@@ -729,11 +783,9 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
                             _local_coordinate_system, integration_order,
                             process_config);
                     break;
+#endif
                 default:
-                    OGS_FATAL(
-                        "SMALL_DEFORMATION_NONLOCAL process does not support "
-                        "given dimension %d",
-                        _mesh_vec[0]->getDimension());
+                    dimensionNotSupported(type, _mesh_vec[0]->getDimension());
             }
         }
         else
@@ -742,8 +794,11 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
             if (type == "SMALL_DEFORMATION_WITH_LIE")
         {
             //! \ogs_file_param{prj__processes__process__SMALL_DEFORMATION_WITH_LIE__dimension}
-            switch (process_config.getConfigParameter<int>("dimension"))
+            auto const dimension =
+                process_config.getConfigParameter<int>("dimension");
+            switch (dimension)
             {
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
                 case 2:
                     process = ProcessLib::LIE::SmallDeformation::
                         createSmallDeformationProcess<2>(
@@ -752,6 +807,8 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
                             _local_coordinate_system, integration_order,
                             process_config);
                     break;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
                 case 3:
                     process = ProcessLib::LIE::SmallDeformation::
                         createSmallDeformationProcess<3>(
@@ -760,10 +817,9 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
                             _local_coordinate_system, integration_order,
                             process_config);
                     break;
+#endif
                 default:
-                    OGS_FATAL(
-                        "SMALL_DEFORMATION_WITH_LIE process does not support "
-                        "given dimension");
+                    dimensionNotSupported(type, dimension);
             }
         }
         else
@@ -772,8 +828,11 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
             if (type == "THERMO_HYDRO_MECHANICS")
         {
             //! \ogs_file_param{prj__processes__process__THERMO_HYDRO_MECHANICS__dimension}
-            switch (process_config.getConfigParameter<int>("dimension"))
+            auto const dimension =
+                process_config.getConfigParameter<int>("dimension");
+            switch (dimension)
             {
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
                 case 2:
                     process = ProcessLib::ThermoHydroMechanics::
                         createThermoHydroMechanicsProcess<2>(
@@ -782,6 +841,8 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
                             _local_coordinate_system, integration_order,
                             process_config);
                     break;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
                 case 3:
                     process = ProcessLib::ThermoHydroMechanics::
                         createThermoHydroMechanicsProcess<3>(
@@ -790,10 +851,9 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
                             _local_coordinate_system, integration_order,
                             process_config);
                     break;
+#endif
                 default:
-                    OGS_FATAL(
-                        "THERMO_HYDRO_MECHANICS process does not support given "
-                        "dimension");
+                    dimensionNotSupported(type, dimension);
             }
         }
         else
@@ -803,6 +863,7 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
         {
             switch (_mesh_vec[0]->getDimension())
             {
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
                 case 2:
                     process = ProcessLib::ThermoMechanicalPhaseField::
                         createThermoMechanicalPhaseFieldProcess<2>(
@@ -811,6 +872,8 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
                             _local_coordinate_system, integration_order,
                             process_config);
                     break;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
                 case 3:
                     process = ProcessLib::ThermoMechanicalPhaseField::
                         createThermoMechanicalPhaseFieldProcess<3>(
@@ -819,6 +882,9 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
                             _local_coordinate_system, integration_order,
                             process_config);
                     break;
+#endif
+                default:
+                    dimensionNotSupported(type, _mesh_vec[0]->getDimension());
             }
         }
         else
@@ -828,6 +894,7 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
         {
             switch (_mesh_vec[0]->getDimension())
             {
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
                 case 2:
                     process = ProcessLib::ThermoMechanics::
                         createThermoMechanicsProcess<2>(
@@ -836,6 +903,8 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
                             _local_coordinate_system, integration_order,
                             process_config);
                     break;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
                 case 3:
                     process = ProcessLib::ThermoMechanics::
                         createThermoMechanicsProcess<3>(
@@ -844,6 +913,9 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
                             _local_coordinate_system, integration_order,
                             process_config);
                     break;
+#endif
+                default:
+                    dimensionNotSupported(type, _mesh_vec[0]->getDimension());
             }
         }
         else
@@ -862,8 +934,11 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
             if (type == "RICHARDS_MECHANICS")
         {
             //! \ogs_file_param{prj__processes__process__RICHARDS_MECHANICS__dimension}
-            switch (process_config.getConfigParameter<int>("dimension"))
+            auto const dimension =
+                process_config.getConfigParameter<int>("dimension");
+            switch (dimension)
             {
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
                 case 2:
                     process = ProcessLib::RichardsMechanics::
                         createRichardsMechanicsProcess<2>(
@@ -872,6 +947,8 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
                             _local_coordinate_system, integration_order,
                             process_config);
                     break;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
                 case 3:
                     process = ProcessLib::RichardsMechanics::
                         createRichardsMechanicsProcess<3>(
@@ -880,6 +957,9 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
                             _local_coordinate_system, integration_order,
                             process_config);
                     break;
+#endif
+                default:
+                    dimensionNotSupported(type, dimension);
             }
         }
         else
@@ -929,6 +1009,10 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
         {
             OGS_FATAL("The process name '%s' is not unique.", name.c_str());
         }
+        if (record_assembly_costs)
+        {
+            process->recordAssemblyCosts();
+        }
         _processes.push_back(std::move(process));
     }
 }
@@ -13,23 +13,179 @@
 
 #include "AsciiRasterInterface.h"
 
+#include <sys/stat.h>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
 #include <logog/include/logog.hpp>
 #include <boost/optional.hpp>
 
 #include "BaseLib/FileTools.h"
+#include "BaseLib/MemoryMappedFile.h"
 #include "BaseLib/StringTools.h"
 
 #include "GeoLib/Raster.h"
 
+namespace
+{
+/// Reads the \c n_rows x \c n_cols whitespace separated raster values from
+/// the remainder of the stream. The file is read in chunks of fixed size and
+/// the values are parsed directly into their final position, i.e., if
+/// \c reverse_rows is set the last row of the file becomes the first row of
+/// the result. Decimal commas are accepted. As for strtod() a token not
+/// starting with a number is read as zero; missing values are set to zero.
+std::vector<double> readValues(std::istream& in, std::size_t const n_cols,
+                               std::size_t const n_rows,
+                               bool const reverse_rows)
+{
+    std::vector<double> values(n_cols * n_rows, 0.0);
+    if (values.empty())
+    {
+        return values;
+    }
+
+    std::size_t row = 0;
+    std::size_t col = 0;
+    std::string token;
+    auto store = [&]() {
+        auto const r = reverse_rows ? n_rows - row - 1 : row;
+        values[r * n_cols + col] = std::strtod(token.c_str(), nullptr);
+        token.clear();
+        if (++col == n_cols)
+        {
+            col = 0;
+            ++row;
+        }
+    };
+
+    std::size_t const chunk_size = 1 << 20;
+    std::vector<char> chunk(chunk_size);
+    while (row < n_rows && in)
+    {
+        in.read(chunk.data(), chunk_size);
+        auto const n_read = static_cast<std::size_t>(in.gcount());
+        for (std::size_t k = 0; k < n_read && row < n_rows; ++k)
+        {
+            char const c = chunk[k];
+            if (!std::isspace(static_cast<unsigned char>(c)))
+            {
+                token.push_back(c == ',' ? '.' : c);
+            }
+            else if (!token.empty())
+            {
+                store();
+            }
+        }
+    }
+    if (!token.empty() && row < n_rows)
+    {
+        store();
+    }
+    return values;
+}
+
+/// Header of the binary copy of an ASC raster file. It is followed by the
+/// raster values in the order used by GeoLib::Raster.
+struct BinaryRasterHeader
+{
+    char magic[8];
+    std::uint64_t n_cols;
+    std::uint64_t n_rows;
+    double origin[3];
+    double cell_size;
+    double no_data;
+    /// Size and modification time of the ASC file the copy was made from.
+    std::int64_t source_size;
+    std::int64_t source_modification_time;
+};
+static_assert(sizeof(BinaryRasterHeader) % alignof(double) == 0,
+              "The raster values must be aligned in the binary file.");
+
+char const binary_raster_magic[8] = {'O', 'G', 'S', 'R', 'A', 'S', 'T', '1'};
+
+/// Returns the header of the binary raster copy if it is valid for the source
+/// file with the given status.
+boost::optional<GeoLib::RasterHeader> readBinaryRasterHeader(
+    std::string const& binary_file_name, struct stat const& source_status)
+{
+    std::ifstream in(binary_file_name, std::ios::binary);
+    if (!in)
+    {
+        return boost::none;
+    }
+    BinaryRasterHeader h;
+    if (!in.read(reinterpret_cast<char*>(&h), sizeof(h)) ||
+        std::memcmp(h.magic, binary_raster_magic, sizeof(h.magic)) != 0 ||
+        h.source_size != static_cast<std::int64_t>(source_status.st_size) ||
+        h.source_modification_time !=
+            static_cast<std::int64_t>(source_status.st_mtime))
+    {
+        return boost::none;
+    }
+    in.seekg(0, std::ios::end);
+    if (static_cast<std::uint64_t>(in.tellg()) !=
+        sizeof(h) + h.n_cols * h.n_rows * sizeof(double))
+    {
+        return boost::none;
+    }
+
+    GeoLib::RasterHeader header;
+    header.n_cols = h.n_cols;
+    header.n_rows = h.n_rows;
+    header.n_depth = 1;
+    header.origin = MathLib::Point3d{{h.origin[0], h.origin[1], h.origin[2]}};
+    header.cell_size = h.cell_size;
+    header.no_data = h.no_data;
+    return header;
+}
+
+bool writeBinaryRaster(GeoLib::Raster const& raster,
+                       struct stat const& source_status,
+                       std::string const& binary_file_name)
+{
+    auto const& header = raster.getHeader();
+    BinaryRasterHeader h;
+    std::copy(std::begin(binary_raster_magic), std::end(binary_raster_magic),
+              h.magic);
+    h.n_cols = header.n_cols;
+    h.n_rows = header.n_rows;
+    std::copy_n(header.origin.getCoords(), 3, h.origin);
+    h.cell_size = header.cell_size;
+    h.no_data = header.no_data;
+    h.source_size = static_cast<std::int64_t>(source_status.st_size);
+    h.source_modification_time =
+        static_cast<std::int64_t>(source_status.st_mtime);
+
+    std::ofstream out(binary_file_name, std::ios::binary);
+    out.write(reinterpret_cast<char const*>(&h), sizeof(h));
+    out.write(reinterpret_cast<char const*>(raster.begin()),
+              (raster.end() - raster.begin()) * sizeof(double));
+    out.close();
+    if (!out)
+    {
+        std::remove(binary_file_name.c_str());
+        return false;
+    }
+    return true;
+}
+}  // namespace
+
 namespace FileIO
 {
 
-GeoLib::Raster* AsciiRasterInterface::readRaster(std::string const& fname)
+GeoLib::Raster* AsciiRasterInterface::readRaster(std::string const& fname,
+                                                 bool const use_binary_cache)
 {
     std::string ext (BaseLib::getFileExtension(fname));
     std::transform(ext.begin(), ext.end(), ext.begin(), tolower);
     if (ext == "asc")
     {
+        if (use_binary_cache)
+        {
+            return getRasterFromASCFileCached(fname);
+        }
         return getRasterFromASCFile(fname);
     }
     if (ext == "grd")
@@ -51,28 +207,62 @@ GeoLib::Raster* AsciiRasterInterface::getRasterFromASCFile(std::string const& fn
     // header information
     GeoLib::RasterHeader header;
     if (readASCHeader(in, header)) {
-        auto* values = new double[header.n_cols * header.n_rows];
-        std::string s;
-        // read the data into the double-array
-        for (std::size_t j(0); j < header.n_rows; ++j) {
-            const std::size_t idx ((header.n_rows - j - 1) * header.n_cols);
-            for (std::size_t i(0); i < header.n_cols; ++i) {
-                in >> s;
-                values[idx + i] = strtod(
-                    BaseLib::replaceString(",", ".", s).c_str(), nullptr);
-            }
-        }
+        // The rows are stored from top to bottom in the file.
+        auto values = readValues(in, header.n_cols, header.n_rows, true);
         in.close();
-        GeoLib::Raster* raster(new GeoLib::Raster(
-            std::move(header), values, values + header.n_cols * header.n_rows));
-        delete [] values;
-        return raster;
+        return new GeoLib::Raster(std::move(header), std::move(values));
     }
     WARN("Raster::getRasterFromASCFile(): Could not read header of file %s",
          fname.c_str());
     return nullptr;
 }
 
+GeoLib::Raster* AsciiRasterInterface::getRasterFromASCFileCached(
+    std::string const& fname)
+{
+    struct stat source_status;
+    if (stat(fname.c_str(), &source_status) != 0)
+    {
+        WARN("Raster::getRasterFromASCFileCached(): Could not open file %s.",
+             fname.c_str());
+        return nullptr;
+    }
+
+    std::string const binary_file_name = fname + ".bin";
+    if (auto header = readBinaryRasterHeader(binary_file_name, source_status))
+    {
+        DBUG("Reading raster values from binary file %s.",
+             binary_file_name.c_str());
+        return new GeoLib::Raster(
+            std::move(*header),
+            std::make_unique<BaseLib::MemoryMappedFile>(binary_file_name),
+            sizeof(BinaryRasterHeader));
+    }
+
+    std::unique_ptr<GeoLib::Raster> raster(getRasterFromASCFile(fname));
+    if (!raster)
+    {
+        return nullptr;
+    }
+    if (!writeBinaryRaster(*raster, source_status, binary_file_name))
+    {
+        WARN(
+            "Raster::getRasterFromASCFileCached(): Could not write binary "
+            "file %s; the raster is kept in memory.",
+            binary_file_name.c_str());
+        return raster.release();
+    }
+    INFO("Wrote binary copy of raster %s to %s.", fname.c_str(),
+         binary_file_name.c_str());
+
+    auto header = raster->getHeader();
+    raster.reset();
+    return new GeoLib::Raster(
+        std::move(header),
+        std::make_unique<BaseLib::MemoryMappedFile>(binary_file_name),
+        sizeof(BinaryRasterHeader));
+}
+
 bool AsciiRasterInterface::readASCHeader(std::ifstream &in, GeoLib::RasterHeader &header)
 {
     std::string tag;
@@ -171,25 +361,13 @@ GeoLib::Raster* AsciiRasterInterface::getRasterFromSurferFile(std::string const&
     if (readSurferHeader(in, header, min, max))
     {
         const double no_data_val (min-1);
-        auto* values = new double[header.n_cols * header.n_rows];
-        std::string s;
-        // read the data into the double-array
-        for (std::size_t j(0); j < header.n_rows; ++j)
+        auto values = readValues(in, header.n_cols, header.n_rows, false);
+        in.close();
+        for (auto& val : values)
         {
-            const std::size_t idx (j * header.n_cols);
-            for (std::size_t i(0); i < header.n_cols; ++i)
-            {
-                in >> s;
-                const double val(strtod(
-                    BaseLib::replaceString(",", ".", s).c_str(), nullptr));
-                values[idx+i] = (val > max || val < min) ? no_data_val : val;
-            }
+            val = (val > max || val < min) ? no_data_val : val;
         }
-        in.close();
-        GeoLib::Raster* raster(new GeoLib::Raster(
-            std::move(header), values, values + header.n_cols * header.n_rows));
-        delete [] values;
-        return raster;
+        return new GeoLib::Raster(std::move(header), std::move(values));
     }
     ERR("Raster::getRasterFromASCFile() - could not read header of file %s",
         fname.c_str());
@@ -281,7 +459,7 @@ static bool allRastersExist(std::vector<std::string> const& raster_paths)
 }
 
 boost::optional<std::vector<GeoLib::Raster const*>> readRasters(
-    std::vector<std::string> const& raster_paths)
+    std::vector<std::string> const& raster_paths, bool const use_binary_cache)
 {
     if (!allRastersExist(raster_paths))
     {
@@ -292,7 +470,8 @@ boost::optional<std::vector<GeoLib::Raster const*>> readRasters(
     rasters.reserve(raster_paths.size());
     for (auto const& path : raster_paths)
     {
-        rasters.push_back(FileIO::AsciiRasterInterface::readRaster(path));
+        rasters.push_back(
+            FileIO::AsciiRasterInterface::readRaster(path, use_binary_cache));
     }
     return boost::make_optional(rasters);
 }
@@ -30,11 +30,25 @@ namespace FileIO
 class AsciiRasterInterface {
 public:
     /// Reads raster file by detecting type based on extension and then calling the apropriate method
-    static GeoLib::Raster* readRaster(std::string const& fname);
+    ///
+    /// If \c use_binary_cache is set, ArcGis ASC raster files are read via
+    /// getRasterFromASCFileCached().
+    static GeoLib::Raster* readRaster(std::string const& fname,
+                                      bool const use_binary_cache = false);
 
     /// Reads an ArcGis ASC raster file
     static GeoLib::Raster* getRasterFromASCFile(std::string const& fname);
 
+    /// Reads an ArcGis ASC raster file using a binary copy of the raster.
+    ///
+    /// The binary copy is stored next to the ASC file with the additional
+    /// extension ".bin" and is recreated if the ASC file's size or
+    /// modification time changed. The returned raster reads its values from
+    /// the memory mapped binary copy, i.e. only the parts of the raster being
+    /// accessed are loaded into memory. If the binary copy can not be written,
+    /// the raster is held in memory as with getRasterFromASCFile().
+    static GeoLib::Raster* getRasterFromASCFileCached(std::string const& fname);
+
     /// Reads a Surfer GRD raster file
     static GeoLib::Raster* getRasterFromSurferFile(std::string const& fname);
 
@@ -53,6 +67,8 @@ private:
 
 /// Reads a vector of rasters given by file names. On error nothing is returned,
 /// otherwise the returned vector contains pointers to the read rasters.
+/// \see AsciiRasterInterface::readRaster() for the \c use_binary_cache option.
 boost::optional<std::vector<GeoLib::Raster const*>> readRasters(
-    std::vector<std::string> const& raster_paths);
+    std::vector<std::string> const& raster_paths,
+    bool const use_binary_cache = false);
 } // end namespace FileIO
@@ -8,6 +8,7 @@
 
 #include "FEFLOWMeshInterface.h"
 
+#include <algorithm>
 #include <cctype>
 #include <memory>
 
@@ -731,27 +732,41 @@ void FEFLOWMeshInterface::setMaterialIDs(
     }
     else if (lines && !lines->empty())
     {
-        for (std::size_t i = 0; i < vec_elements.size(); ++i)
+        std::vector<MeshLib::Node> centers;
+        centers.reserve(vec_elements.size());
+        for (MeshLib::Element const* e : vec_elements)
         {
-            MeshLib::Element const* e = vec_elements[i];
-            MeshLib::Node const gpt = e->getCenterOfGravity();
-            std::size_t matId = 0;
-            for (std::size_t j = 0; j < lines->size(); j++)
+            centers.push_back(e->getCenterOfGravity());
+        }
+        std::vector<MathLib::Point3d const*> center_pnts;
+        center_pnts.reserve(centers.size());
+        for (auto const& center : centers)
+        {
+            center_pnts.push_back(&center);
+        }
+
+        // The first closed polyline containing the element's center of
+        // gravity determines the material id.
+        std::fill(material_ids.begin(), material_ids.end(), 0);
+        std::vector<bool> assigned(vec_elements.size(), false);
+        for (std::size_t j = 0; j < lines->size(); j++)
+        {
+            GeoLib::Polyline* poly = (*lines)[j];
+            if (!poly->isClosed())
             {
-                GeoLib::Polyline* poly = (*lines)[j];
-                if (!poly->isClosed())
-                {
-                    continue;
-                }
+                continue;
+            }
 
-                GeoLib::Polygon polygon(*poly, true);
-                if (polygon.isPntInPolygon(gpt[0], gpt[1], gpt[2]))
+            GeoLib::Polygon polygon(*poly, true);
+            auto const inside = polygon.arePntsInPolygon(center_pnts);
+            for (std::size_t i = 0; i < vec_elements.size(); ++i)
+            {
+                if (inside[i] && !assigned[i])
                 {
-                    matId = j;
-                    break;
+                    material_ids[i] = j;
+                    assigned[i] = true;
                 }
             }
-            material_ids[i] = matId;
         }
     }
     else if (fem_class.n_layers3d > 0)
@@ -0,0 +1,65 @@
+/**
+ * @file BinaryMeshConverter.cpp
+ * @brief Converts meshes from and to the native binary mesh format.
+ *
+ * @copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/LICENSE.txt
+ */
+
+#include <memory>
+#include <string>
+
+#include <tclap/CmdLine.h>
+
+#include "Applications/ApplicationsLib/LogogSetup.h"
+#include "BaseLib/BuildInfo.h"
+#include "MeshLib/IO/readMeshFromFile.h"
+#include "MeshLib/IO/writeMeshToFile.h"
+#include "MeshLib/Mesh.h"
+
+int main(int argc, char* argv[])
+{
+    ApplicationsLib::LogogSetup logog_setup;
+
+    TCLAP::CmdLine cmd(
+        "Converts a mesh (vtu, msh) into the native binary mesh format (bmsh) "
+        "or vice versa. The format is determined by the file extensions. The "
+        "binary format is memory mapped on reading and stores the node "
+        "coordinates, the element connectivity and the property vectors.\n\n"
+        "OpenGeoSys-6 software, version " +
+            BaseLib::BuildInfo::ogs_version +
+            ".\n"
+            "Copyright (c) 2012-2019, OpenGeoSys Community "
+            "(http://www.opengeosys.org)",
+        ' ', BaseLib::BuildInfo::ogs_version);
+    TCLAP::ValueArg<std::string> mesh_in(
+        "i", "mesh-input-file",
+        "the name of the file containing the input mesh", true, "",
+        "file name of input mesh");
+    cmd.add(mesh_in);
+    TCLAP::ValueArg<std::string> mesh_out(
+        "o", "mesh-output-file",
+        "the name of the file the mesh will be written to", true, "",
+        "file name of output mesh");
+    cmd.add(mesh_out);
+    cmd.parse(argc, argv);
+
+    std::unique_ptr<MeshLib::Mesh const> mesh(
+        MeshLib::IO::readMeshFromFileSerial(mesh_in.getValue()));
+    if (!mesh)
+    {
+        return EXIT_FAILURE;
+    }
+    INFO("Mesh read: %d nodes, %d elements.", mesh->getNumberOfNodes(),
+         mesh->getNumberOfElements());
+
+    if (MeshLib::IO::writeMeshToFile(*mesh, mesh_out.getValue()) != 0)
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -105,6 +105,14 @@ int main (int argc, char* argv[])
         false, false, "boolean value");
     cmd.add(use_ascii_arg);
 
+    TCLAP::SwitchArg binary_raster_cache_arg(
+        "", "binary-raster-cache",
+        "Store a binary copy of each asc-raster next to the raster file "
+        "(extension '.bin') and read the raster values from the memory "
+        "mapped copy. Speeds up subsequent runs and bounds the memory "
+        "required for large rasters.");
+    cmd.add(binary_raster_cache_arg);
+
     cmd.parse(argc, argv);
 
     if (min_thickness_arg.isSet())
@@ -139,7 +147,8 @@ int main (int argc, char* argv[])
     }
 
     MeshLib::MeshLayerMapper mapper;
-    if (auto rasters = FileIO::readRasters(raster_paths))
+    if (auto rasters = FileIO::readRasters(raster_paths,
+                                           binary_raster_cache_arg.getValue()))
     {
         if (!mapper.createLayers(*sfc_mesh, *rasters, min_thickness))
         {
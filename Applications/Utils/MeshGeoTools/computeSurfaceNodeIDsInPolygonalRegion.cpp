@@ -147,10 +147,12 @@ int main (int argc, char* argv[])
         GeoLib::Polygon const polygon{*plys[j]};
         // ids of mesh nodes on surface that are within the given polygon
         std::vector<std::pair<std::size_t, double>> ids_and_areas;
+        std::vector<bool> const inside(
+            polygon.arePntsInPolygon(all_sfc_nodes));
         for (std::size_t k(0); k<all_sfc_nodes.size(); k++) {
-            MeshLib::Node const& pnt(*(all_sfc_nodes[k]));
-            if (polygon.isPntInPolygon(pnt[0], pnt[1], pnt[2])) {
-                ids_and_areas.emplace_back(pnt.getID(), areas[k]);
+            if (inside[k]) {
+                ids_and_areas.emplace_back(all_sfc_nodes[k]->getID(),
+                                           areas[k]);
             }
         }
         if (ids_and_areas.empty()) {
@@ -9,7 +9,11 @@
  *
  */
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
+
+#include <metis.h>
 
 #include "BaseLib/Error.h"
 #include "MeshLib/Elements/Element.h"
@@ -42,6 +46,110 @@ void writeMETIS(std::vector<MeshLib::Element*> const& elements,
     }
 }
 
+std::vector<std::size_t> computeNodeWeights(
+    std::vector<MeshLib::Element*> const& elements,
+    std::size_t const number_of_nodes,
+    std::vector<double> const& element_weights)
+{
+    if (element_weights.size() != elements.size())
+    {
+        OGS_FATAL(
+            "The number of element weights (%d) differs from the number of "
+            "elements (%d).",
+            element_weights.size(), elements.size());
+    }
+    std::vector<double> node_costs(number_of_nodes, 0.0);
+    for (std::size_t e = 0; e < elements.size(); e++)
+    {
+        double const cost = element_weights[e];
+        if (cost < 0)
+        {
+            OGS_FATAL("The weight %g of element %d is negative.", cost, e);
+        }
+        auto const* elem = elements[e];
+        unsigned const n_element_nodes = elem->getNumberOfNodes();
+        for (unsigned j = 0; j < n_element_nodes; j++)
+        {
+            node_costs[elem->getNodeIndex(j)] += cost / n_element_nodes;
+        }
+    }
+
+    // METIS takes integer vertex weights; the node costs are scaled such that
+    // the most expensive node gets the weight max_weight and every node gets
+    // at least weight one.
+    double const max_weight = 1000;
+    double const max_cost =
+        node_costs.empty()
+            ? 0
+            : *std::max_element(node_costs.begin(), node_costs.end());
+    double const scaling = max_cost > 0 ? max_weight / max_cost : 0;
+    std::vector<std::size_t> node_weights;
+    node_weights.reserve(number_of_nodes);
+    for (double const cost : node_costs)
+    {
+        node_weights.push_back(1 + static_cast<std::size_t>(cost * scaling));
+    }
+    return node_weights;
+}
+
+std::vector<std::size_t> computePartitionIDsWithMETIS(
+    std::vector<MeshLib::Element*> const& elements,
+    std::size_t const number_of_nodes,
+    long const number_of_partitions,
+    std::vector<double> const* const element_weights)
+{
+    // Element connectivity in compressed row storage.
+    std::vector<idx_t> eptr;
+    eptr.reserve(elements.size() + 1);
+    eptr.push_back(0);
+    std::vector<idx_t> eind;
+    for (const auto* elem : elements)
+    {
+        for (unsigned j = 0; j < elem->getNumberOfNodes(); j++)
+        {
+            eind.push_back(static_cast<idx_t>(elem->getNodeIndex(j)));
+        }
+        if (eind.size() >
+            static_cast<std::size_t>(std::numeric_limits<idx_t>::max()))
+        {
+            OGS_FATAL(
+                "The mesh is too large for the integer type of the METIS "
+                "library (%d bytes). Rebuild METIS with IDXTYPEWIDTH=64.",
+                sizeof(idx_t));
+        }
+        eptr.push_back(static_cast<idx_t>(eind.size()));
+    }
+
+    idx_t ne = static_cast<idx_t>(elements.size());
+    idx_t nn = static_cast<idx_t>(number_of_nodes);
+    idx_t nparts = static_cast<idx_t>(number_of_partitions);
+    idx_t objval = 0;
+    std::vector<idx_t> epart(elements.size());
+    std::vector<idx_t> npart(number_of_nodes);
+
+    std::vector<idx_t> vwgt;
+    if (element_weights)
+    {
+        auto const node_weights =
+            computeNodeWeights(elements, number_of_nodes, *element_weights);
+        vwgt.assign(node_weights.begin(), node_weights.end());
+    }
+
+    idx_t options[METIS_NOPTIONS];
+    METIS_SetDefaultOptions(options);
+
+    int const status = METIS_PartMeshNodal(
+        &ne, &nn, eptr.data(), eind.data(), vwgt.empty() ? nullptr : vwgt.data(),
+        nullptr, &nparts, nullptr,
+        options, &objval, epart.data(), npart.data());
+    if (status != METIS_OK)
+    {
+        OGS_FATAL("METIS_PartMeshNodal failed with error code %d.", status);
+    }
+
+    return std::vector<std::size_t>(npart.begin(), npart.end());
+}
+
 std::vector<std::size_t> readMetisData(const std::string& file_name_base,
                                        long const number_of_partitions,
                                        std::size_t const number_of_nodes)
@@ -27,6 +27,35 @@ namespace ApplicationUtils
 void writeMETIS(std::vector<MeshLib::Element*> const& elements,
                 const std::string& file_name);
 
+/// Computes the METIS vertex weights of the mesh nodes. Each element's weight
+/// is distributed equally to its nodes; the resulting node costs are scaled
+/// to integers between 1 and 1001, the most expensive node getting 1001.
+/// \param elements The mesh elements.
+/// \param number_of_nodes The number of mesh nodes.
+/// \param element_weights Non-negative computational costs of the elements.
+/// \return The weight of each node.
+std::vector<std::size_t> computeNodeWeights(
+    std::vector<MeshLib::Element*> const& elements,
+    std::size_t number_of_nodes,
+    std::vector<double> const& element_weights);
+
+/// Partitions the mesh nodes by calling the METIS library directly
+/// (METIS_PartMeshNodal with default options), which gives the same node
+/// partitioning as running mpmetis with -gtype=nodal on the file written by
+/// writeMETIS().
+/// \param elements The mesh elements.
+/// \param number_of_nodes The number of mesh nodes.
+/// \param number_of_partitions The number of partitions.
+/// \param element_weights Optional non-negative computational costs of the
+/// elements, e.g. recorded assembly times, which are balanced as METIS vertex
+/// weights of the nodes, see computeNodeWeights().
+/// \return The partition id of each node.
+std::vector<std::size_t> computePartitionIDsWithMETIS(
+    std::vector<MeshLib::Element*> const& elements,
+    std::size_t number_of_nodes,
+    long number_of_partitions,
+    std::vector<double> const* element_weights = nullptr);
+
 /// Read metis data
 /// \param file_name_base The prefix of the filename.
 /// \param number_of_partitions The number is used to compose the full filename
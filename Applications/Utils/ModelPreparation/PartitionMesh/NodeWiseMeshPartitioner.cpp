@@ -14,9 +14,11 @@
 
 #include "NodeWiseMeshPartitioner.h"
 
+#include <algorithm>
 #include <limits>
 #include <numeric>
 #include <unordered_map>
+#include <unordered_set>
 
 #include <logog/include/logog.hpp>
 
@@ -127,111 +129,70 @@ std::size_t partitionLookup(
     return partition_ids[node_id(node)];
 }
 
-/// 1 copy pointers to nodes belonging to the partition part_id into base nodes
-/// vector, and
-/// 2 collect non-linear element nodes belonging to the partition part_id in
-/// extra nodes vector.
+/// Sorts the nodes and the elements into the partitions in a single pass over
+/// the mesh:
+/// 1 the nodes of each partition in the order of the mesh nodes,
+/// 2 the regular elements, i.e. all nodes belong to the partition, and
+/// 3 the ghost elements, i.e. some but not all nodes belong to the partition,
+///   both in the order of the mesh elements.
 /// If \c node_id_mapping is given, it will be used to map the mesh node ids to
 /// other ids; used by boundary meshes, for example.
-/// \return a pair of base node and extra nodes.
-std::pair<std::vector<MeshLib::Node*>, std::vector<MeshLib::Node*>>
-findNonGhostNodesInPartition(
-    std::size_t const part_id,
-    const bool is_mixed_high_order_linear_elems,
-    std::size_t const n_base_nodes,
-    std::vector<MeshLib::Node*> const& nodes,
+void sortMeshItemsIntoPartitions(
+    std::vector<Partition>& partitions,
+    std::vector<std::vector<MeshLib::Node*>>& partition_nodes,
+    MeshLib::Mesh const& mesh,
     std::vector<std::size_t> const& partition_ids,
-    std::vector<std::size_t> const* node_id_mapping = nullptr)
+    std::vector<std::size_t> const* node_id_mapping)
 {
-    auto node_id = [&node_id_mapping](MeshLib::Node const& n) {
-        return nodeIdBulkMesh(n, node_id_mapping);
+    auto const n_partitions = partitions.size();
+    auto partition_of = [&](MeshLib::Node const& n) {
+        auto const part_id =
+            partitionLookup(n, partition_ids, node_id_mapping);
+        if (part_id >= n_partitions)
+        {
+            OGS_FATAL(
+                "Node %d is assigned to partition %d but there are only %d "
+                "partitions.",
+                n.getID(), part_id, n_partitions);
+        }
+        return part_id;
     };
 
-    // Find nodes belonging to a given partition id.
-    std::vector<MeshLib::Node*> partition_nodes;
-    copy_if(begin(nodes), end(nodes), std::back_inserter(partition_nodes),
-            [&](auto const& n) {
-                return partitionLookup(*n, partition_ids, node_id_mapping) ==
-                       part_id;
-            });
-
-    // Space for resulting vectors.
-    std::vector<MeshLib::Node*> base_nodes;
-    base_nodes.reserve(partition_nodes.size() /
-                       2);  // if linear mesh, then one reallocation, no realloc
-                            // for higher order elements meshes.
-    std::vector<MeshLib::Node*> higher_order_nodes;
-    higher_order_nodes.reserve(
-        partition_nodes.size() /
-        2);  // if linear mesh, then wasted space, good estimate for quadratic
-             // order mesh, and realloc needed for higher order element meshes.
-
-    // Split the nodes into base nodes and extra nodes.
-    partition_copy(begin(partition_nodes), end(partition_nodes),
-                   std::back_inserter(base_nodes),
-                   std::back_inserter(higher_order_nodes),
-                   [&](MeshLib::Node* const n) {
-                       return !is_mixed_high_order_linear_elems ||
-                              node_id(*n) > n_base_nodes;
-                   });
-
-    return {base_nodes, higher_order_nodes};
-}
-
-std::ptrdiff_t numberOfRegularNodes(
-    MeshLib::Element const& e, std::size_t const part_id,
-    std::vector<std::size_t> const& partition_ids,
-    std::vector<std::size_t> const* node_id_mapping = nullptr)
-{
-    return std::count_if(e.getNodes(), e.getNodes() + e.getNumberOfNodes(),
-                         [&](MeshLib::Node* const n) {
-                             return partitionLookup(*n, partition_ids,
-                                                    node_id_mapping) == part_id;
-                         });
-}
-
-/// 1 find elements belonging to the partition part_id:
-/// fills vector partition.regular_elements
-/// 2 find ghost elements belonging to the partition part_id
-/// fills vector partition.ghost_elements
-std::tuple<std::vector<MeshLib::Element const*>,
-           std::vector<MeshLib::Element const*>>
-findElementsInPartition(
-    std::size_t const part_id,
-    std::vector<MeshLib::Element*> const& elements,
-    std::vector<std::size_t> const& partition_ids,
-    std::vector<std::size_t> const* node_id_mapping = nullptr)
-{
-    std::vector<MeshLib::Element const*> regular_elements;
-    std::vector<MeshLib::Element const*> ghost_elements;
-
-    for (auto elem : elements)
+    partition_nodes.assign(n_partitions, {});
+    for (auto* const node : mesh.getNodes())
     {
-        auto const regular_nodes = numberOfRegularNodes(
-            *elem, part_id, partition_ids, node_id_mapping);
+        partition_nodes[partition_of(*node)].push_back(node);
+    }
 
-        if (regular_nodes == 0)
+    // The distinct partitions of the element's nodes.
+    std::vector<std::size_t> element_partitions;
+    for (auto const* const elem : mesh.getElements())
+    {
+        element_partitions.clear();
+        for (unsigned i = 0; i < elem->getNumberOfNodes(); i++)
         {
-            continue;
+            element_partitions.push_back(partition_of(*elem->getNode(i)));
         }
+        std::sort(begin(element_partitions), end(element_partitions));
+        element_partitions.erase(
+            std::unique(begin(element_partitions), end(element_partitions)),
+            end(element_partitions));
 
-        if (regular_nodes ==
-            static_cast<std::ptrdiff_t>(elem->getNumberOfNodes()))
+        if (element_partitions.size() == 1)
         {
-            regular_elements.push_back(elem);
+            partitions[element_partitions.front()].regular_elements.push_back(
+                elem);
+            continue;
         }
-        else
+        for (auto const part_id : element_partitions)
         {
-            ghost_elements.push_back(elem);
+            partitions[part_id].ghost_elements.push_back(elem);
         }
     }
-    return std::tuple<std::vector<MeshLib::Element const*>,
-                      std::vector<MeshLib::Element const*>>{regular_elements,
-                                                            ghost_elements};
 }
 
 /// Prerequisite: the ghost elements has to be found (using
-/// findElementsInPartition).
+/// sortMeshItemsIntoPartitions).
 /// Finds ghost nodes and non-linear element ghost nodes by walking over
 /// ghost elements.
 std::tuple<std::vector<MeshLib::Node*>, std::vector<MeshLib::Node*>>
@@ -251,29 +212,29 @@ findGhostNodesInPartition(
     std::vector<MeshLib::Node*> base_nodes;
     std::vector<MeshLib::Node*> ghost_nodes;
 
-    std::vector<bool> nodes_reserved(nodes.size(), false);
+    // Only the nodes of the ghost elements are visited, hence a set instead of
+    // a flag per mesh node keeps the costs proportional to the partition size.
+    std::unordered_set<std::size_t> nodes_reserved;
     for (const auto* ghost_elem : ghost_elements)
     {
         for (unsigned i = 0; i < ghost_elem->getNumberOfNodes(); i++)
         {
             auto const& n = ghost_elem->getNode(i);
-            if (nodes_reserved[n->getID()])
+            if (partitionLookup(*n, partition_ids, node_id_mapping) ==
+                    part_id ||
+                !nodes_reserved.insert(n->getID()).second)
             {
                 continue;
             }
 
-            if (partitionLookup(*n, partition_ids, node_id_mapping) != part_id)
+            if (!is_mixed_high_order_linear_elems ||
+                node_id(*n) > number_of_base_nodes)
             {
-                if (!is_mixed_high_order_linear_elems ||
-                    node_id(*n) > number_of_base_nodes)
-                {
-                    base_nodes.push_back(nodes[n->getID()]);
-                }
-                else
-                {
-                    ghost_nodes.push_back(nodes[n->getID()]);
-                }
-                nodes_reserved[n->getID()] = true;
+                base_nodes.push_back(nodes[n->getID()]);
+            }
+            else
+            {
+                ghost_nodes.push_back(nodes[n->getID()]);
             }
         }
     }
@@ -281,50 +242,77 @@ findGhostNodesInPartition(
         base_nodes, ghost_nodes};
 }
 
-void NodeWiseMeshPartitioner::processPartition(
-    std::size_t const part_id, const bool is_mixed_high_order_linear_elems)
+/// Fills the partitions with the nodes, the regular and ghost elements, and the
+/// ghost nodes of the given mesh. The mesh is traversed once, afterwards the
+/// partitions are completed independently of each other.
+/// If \c node_id_mapping is given, it will be used to map the mesh node ids to
+/// other ids; used by boundary meshes, for example.
+void partitionMesh(std::vector<Partition>& partitions,
+                   MeshLib::Mesh const& mesh,
+                   std::vector<std::size_t> const& partition_ids,
+                   const bool is_mixed_high_order_linear_elems,
+                   std::vector<std::size_t> const* node_id_mapping = nullptr)
 {
-    auto& partition = _partitions[part_id];
-    std::vector<MeshLib::Node*> higher_order_regular_nodes;
-    std::tie(partition.nodes, higher_order_regular_nodes) =
-        findNonGhostNodesInPartition(part_id, is_mixed_high_order_linear_elems,
-                                     _mesh->getNumberOfBaseNodes(),
-                                     _mesh->getNodes(), _nodes_partition_ids);
-
-    partition.number_of_non_ghost_base_nodes = partition.nodes.size();
-    partition.number_of_non_ghost_nodes =
-        partition.number_of_non_ghost_base_nodes +
-        higher_order_regular_nodes.size();
-
-    std::tie(partition.regular_elements, partition.ghost_elements) =
-        findElementsInPartition(part_id, _mesh->getElements(),
-                                _nodes_partition_ids);
-    std::vector<MeshLib::Node*> base_ghost_nodes;
-    std::vector<MeshLib::Node*> higher_order_ghost_nodes;
-    std::tie(base_ghost_nodes, higher_order_ghost_nodes) =
-        findGhostNodesInPartition(part_id, is_mixed_high_order_linear_elems,
-                                  _mesh->getNumberOfBaseNodes(),
-                                  _mesh->getNodes(), partition.ghost_elements,
-                                  _nodes_partition_ids);
-
-    std::copy(begin(base_ghost_nodes), end(base_ghost_nodes),
-              std::back_inserter(partition.nodes));
-
-    partition.number_of_base_nodes = partition.nodes.size();
-
-    if (is_mixed_high_order_linear_elems)
+    auto node_id = [&node_id_mapping](MeshLib::Node const& n) {
+        return nodeIdBulkMesh(n, node_id_mapping);
+    };
+
+    std::vector<std::vector<MeshLib::Node*>> partition_nodes;
+    sortMeshItemsIntoPartitions(partitions, partition_nodes, mesh,
+                                partition_ids, node_id_mapping);
+
+    std::size_t const n_base_nodes = mesh.getNumberOfBaseNodes();
+    auto const n_partitions = static_cast<long long>(partitions.size());
+#pragma omp parallel for schedule(dynamic)
+    for (long long part_id = 0; part_id < n_partitions; part_id++)
     {
-        std::copy(begin(higher_order_regular_nodes),
-                  end(higher_order_regular_nodes),
-                  std::back_inserter(partition.nodes));
-        std::copy(begin(higher_order_ghost_nodes),
-                  end(higher_order_ghost_nodes),
+        auto& partition = partitions[part_id];
+        auto& nodes = partition_nodes[part_id];
+
+        // Split the nodes into base nodes and extra nodes.
+        std::vector<MeshLib::Node*> higher_order_regular_nodes;
+        partition.nodes.reserve(nodes.size());
+        partition_copy(begin(nodes), end(nodes),
+                       std::back_inserter(partition.nodes),
+                       std::back_inserter(higher_order_regular_nodes),
+                       [&](MeshLib::Node* const n) {
+                           return !is_mixed_high_order_linear_elems ||
+                                  node_id(*n) > n_base_nodes;
+                       });
+        std::vector<MeshLib::Node*>().swap(nodes);
+
+        partition.number_of_non_ghost_base_nodes = partition.nodes.size();
+        partition.number_of_non_ghost_nodes =
+            partition.number_of_non_ghost_base_nodes +
+            higher_order_regular_nodes.size();
+
+        std::vector<MeshLib::Node*> base_ghost_nodes;
+        std::vector<MeshLib::Node*> higher_order_ghost_nodes;
+        std::tie(base_ghost_nodes, higher_order_ghost_nodes) =
+            findGhostNodesInPartition(
+                part_id, is_mixed_high_order_linear_elems, n_base_nodes,
+                mesh.getNodes(), partition.ghost_elements, partition_ids,
+                node_id_mapping);
+
+        std::copy(begin(base_ghost_nodes), end(base_ghost_nodes),
                   std::back_inserter(partition.nodes));
-    }
 
-    // Set the node numbers of base and all mesh nodes.
-    partition.number_of_mesh_base_nodes = _mesh->getNumberOfBaseNodes();
-    partition.number_of_mesh_all_nodes = _mesh->getNumberOfNodes();
+        partition.number_of_base_nodes = partition.nodes.size();
+
+        if (is_mixed_high_order_linear_elems)
+        {
+            std::copy(begin(higher_order_regular_nodes),
+                      end(higher_order_regular_nodes),
+                      std::back_inserter(partition.nodes));
+            std::copy(begin(higher_order_ghost_nodes),
+                      end(higher_order_ghost_nodes),
+                      std::back_inserter(partition.nodes));
+        }
+
+        // Set the node numbers of base and all mesh nodes.
+        partition.number_of_mesh_base_nodes = n_base_nodes;
+        partition.number_of_mesh_all_nodes = mesh.getNumberOfNodes();
+    }
 }
 
 /// Copies the properties from global property vector \c pv to the
@@ -408,10 +396,21 @@ bool copyPropertyVector(MeshLib::Properties const& original_properties,
             pv->getMeshItemType());
     };
 
-    std::size_t position_offset(0);
-    for (auto p : partitions)
+    // The partitions are copied into disjoint ranges of the partitioned
+    // property vector.
+    std::vector<std::size_t> position_offsets(partitions.size() + 1, 0);
+    for (std::size_t i = 0; i < partitions.size(); i++)
     {
-        position_offset += copy_property_vector_values(p, position_offset);
+        position_offsets[i + 1] =
+            position_offsets[i] +
+            partitions[i].numberOfMeshItems(pv->getMeshItemType());
+    }
+
+    auto const n_partitions = static_cast<long long>(partitions.size());
+#pragma omp parallel for schedule(dynamic)
+    for (long long i = 0; i < n_partitions; i++)
+    {
+        copy_property_vector_values(partitions[i], position_offsets[i]);
     }
     return true;
 }
@@ -486,11 +485,9 @@ MeshLib::Properties partitionProperties(
 void NodeWiseMeshPartitioner::partitionByMETIS(
     const bool is_mixed_high_order_linear_elems)
 {
-    for (std::size_t part_id = 0; part_id < _partitions.size(); part_id++)
-    {
-        INFO("Processing partition: %d", part_id);
-        processPartition(part_id, is_mixed_high_order_linear_elems);
-    }
+    INFO("Processing %d partitions.", _partitions.size());
+    partitionMesh(_partitions, *_mesh, _nodes_partition_ids,
+                  is_mixed_high_order_linear_elems);
 
     renumberNodeIndices(is_mixed_high_order_linear_elems);
 
@@ -605,53 +602,9 @@ std::vector<Partition> NodeWiseMeshPartitioner::partitionOtherMesh(
             "bulk_node_ids", MeshLib::MeshItemType::Node, 1);
 
     std::vector<Partition> partitions(_partitions.size());
-    for (std::size_t part_id = 0; part_id < _partitions.size(); part_id++)
-    {
-        auto& partition = partitions[part_id];
-        INFO("Processing partition: %d", part_id);
-        // Set the node numbers of base and all mesh nodes.
-        partition.number_of_mesh_base_nodes = mesh.getNumberOfBaseNodes();
-        partition.number_of_mesh_all_nodes = mesh.getNumberOfNodes();
-
-        std::vector<MeshLib::Node*> higher_order_regular_nodes;
-        std::tie(partition.nodes, higher_order_regular_nodes) =
-            findNonGhostNodesInPartition(
-                part_id, is_mixed_high_order_linear_elems,
-                mesh.getNumberOfBaseNodes(), mesh.getNodes(),
-                _nodes_partition_ids, bulk_node_ids);
-
-        partition.number_of_non_ghost_base_nodes = partition.nodes.size();
-        partition.number_of_non_ghost_nodes =
-            partition.number_of_non_ghost_base_nodes +
-            higher_order_regular_nodes.size();
-
-        std::tie(partition.regular_elements, partition.ghost_elements) =
-            findElementsInPartition(part_id, mesh.getElements(),
-                                    _nodes_partition_ids, bulk_node_ids);
-
-        std::vector<MeshLib::Node*> base_ghost_nodes;
-        std::vector<MeshLib::Node*> higher_order_ghost_nodes;
-        std::tie(base_ghost_nodes, higher_order_ghost_nodes) =
-            findGhostNodesInPartition(part_id, is_mixed_high_order_linear_elems,
-                                      mesh.getNumberOfBaseNodes(),
-                                      mesh.getNodes(), partition.ghost_elements,
-                                      _nodes_partition_ids, bulk_node_ids);
-
-        std::copy(begin(base_ghost_nodes), end(base_ghost_nodes),
-                  std::back_inserter(partition.nodes));
-
-        partition.number_of_base_nodes = partition.nodes.size();
-
-        if (is_mixed_high_order_linear_elems)
-        {
-            std::copy(begin(higher_order_regular_nodes),
-                      end(higher_order_regular_nodes),
-                      std::back_inserter(partition.nodes));
-            std::copy(begin(higher_order_ghost_nodes),
-                      end(higher_order_ghost_nodes),
-                      std::back_inserter(partition.nodes));
-        }
-    }
+    INFO("Processing %d partitions.", partitions.size());
+    partitionMesh(partitions, mesh, _nodes_partition_ids,
+                  is_mixed_high_order_linear_elems, bulk_node_ids);
 
     return partitions;
 }
@@ -942,7 +895,11 @@ void writeElementsBinary(std::string const& file_name_base,
                   file_name_ele_g.c_str());
     }
 
-    for (std::size_t i = 0; i < partitions.size(); i++)
+    // The element data of the partitions are generated in parallel and are
+    // written in the order of the partitions as soon as they are available.
+    auto const n_partitions = static_cast<long long>(partitions.size());
+#pragma omp parallel for ordered schedule(static, 1)
+    for (long long i = 0; i < n_partitions; i++)
     {
         const auto& partition = partitions[i];
         auto const local_node_ids = enumerateLocalNodeIds(partition.nodes);
@@ -961,26 +918,31 @@ void writeElementsBinary(std::string const& file_name_base,
             getElementIntegerVariables(*elem, local_node_ids, ele_info,
                                        counter);
         }
-        // Write vector data of non-ghost elements
-        element_info_os.write(reinterpret_cast<const char*>(ele_info.data()),
-                              ele_info.size() * sizeof(long));
 
         // Ghost elements
-        ele_info.resize(num_g_elem_integers[i]);
+        std::vector<long> ghost_ele_info(num_g_elem_integers[i]);
 
         counter = partition.ghost_elements.size();
 
         for (std::size_t j = 0; j < partition.ghost_elements.size(); j++)
         {
             const auto* elem = partition.ghost_elements[j];
-            ele_info[j] = counter;
-            getElementIntegerVariables(*elem, local_node_ids, ele_info,
+            ghost_ele_info[j] = counter;
+            getElementIntegerVariables(*elem, local_node_ids, ghost_ele_info,
                                        counter);
         }
-        // Write vector data of ghost elements
-        ghost_element_info_os.write(
-            reinterpret_cast<const char*>(ele_info.data()),
-            ele_info.size() * sizeof(long));
+
+#pragma omp ordered
+        {
+            // Write vector data of non-ghost elements
+            element_info_os.write(
+                reinterpret_cast<const char*>(ele_info.data()),
+                ele_info.size() * sizeof(long));
+            // Write vector data of ghost elements
+            ghost_element_info_os.write(
+                reinterpret_cast<const char*>(ghost_ele_info.data()),
+                ghost_ele_info.size() * sizeof(long));
+        }
     }
 }
 
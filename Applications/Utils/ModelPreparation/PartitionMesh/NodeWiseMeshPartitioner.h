@@ -143,9 +143,6 @@ private:
     /// interpolation
     void renumberNodeIndices(const bool is_mixed_high_order_linear_elems);
 
-    void processPartition(std::size_t const part_id,
-                          const bool is_mixed_high_order_linear_elems);
-
     /// Write the configuration data of the partition data in ASCII files.
     /// \param file_name_base The prefix of the file name.
     void writeConfigDataASCII(const std::string& file_name_base);
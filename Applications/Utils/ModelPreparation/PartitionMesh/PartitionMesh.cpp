@@ -32,6 +32,34 @@
 
 using namespace ApplicationUtils;
 
+/// Copies the values of the scalar cell property \c name, which may be of any
+/// arithmetic type, into a vector of element weights.
+std::vector<double> getElementWeights(MeshLib::Mesh const& mesh,
+                                      std::string const& name)
+{
+    auto const& properties = mesh.getProperties();
+    auto copy_weights = [&](auto type, std::vector<double>& weights) {
+        using T = decltype(type);
+        if (!properties.existsPropertyVector<T>(
+                name, MeshLib::MeshItemType::Cell, 1))
+        {
+            return false;
+        }
+        auto const& pv = *properties.getPropertyVector<T>(name);
+        weights.assign(pv.begin(), pv.end());
+        return true;
+    };
+
+    std::vector<double> weights;
+    if (!(copy_weights(double{}, weights) || copy_weights(float{}, weights) ||
+          copy_weights(int{}, weights) || copy_weights(long{}, weights) ||
+          copy_weights(std::size_t{}, weights)))
+    {
+        OGS_FATAL("The mesh has no scalar cell property '%s'.", name.c_str());
+    }
+    return weights;
+}
+
 int main(int argc, char* argv[])
 {
     ApplicationsLib::LogogSetup logog_setup;
@@ -77,6 +105,22 @@ int main(int argc, char* argv[])
         false);
     cmd.add(exe_metis_flag);
 
+    TCLAP::SwitchArg metis_library_flag(
+        "l", "metis_library",
+        "Partition the mesh by calling the METIS library directly instead of "
+        "using the METIS files; no intermediate files are written.",
+        false);
+    cmd.add(metis_library_flag);
+
+    TCLAP::ValueArg<std::string> element_weights_arg(
+        "w", "element_weights",
+        "name of a scalar cell property of the mesh with the computational "
+        "costs of the elements, e.g. 'assembly_cost' recorded by a previous "
+        "serial run; the partitions are balanced with respect to these costs. "
+        "Requires --metis_library.",
+        false, "", "property name");
+    cmd.add(element_weights_arg);
+
     TCLAP::SwitchArg lh_elems_flag(
         "q", "lh_elements", "Mixed linear and high order elements.", false);
     cmd.add(lh_elems_flag);
@@ -138,8 +182,32 @@ int main(int argc, char* argv[])
             "-np=1'.");
     }
 
+    if (element_weights_arg.isSet() && !metis_library_flag.getValue())
+    {
+        OGS_FATAL(
+            "Element weights are only supported together with the "
+            "--metis_library option.");
+    }
+
+    if (metis_library_flag.getValue())
+    {
+        auto const& mesh = mesh_partitioner.mesh();
+        std::vector<double> element_weights;
+        if (element_weights_arg.isSet())
+        {
+            auto const& name = element_weights_arg.getValue();
+            INFO("Using the cell property '%s' as element weights.",
+                 name.c_str());
+            element_weights = getElementWeights(mesh, name);
+        }
+
+        INFO("METIS is running ...");
+        mesh_partitioner.resetPartitionIdsForNodes(computePartitionIDsWithMETIS(
+            mesh.getElements(), mesh.getNumberOfNodes(), num_partitions,
+            element_weights_arg.isSet() ? &element_weights : nullptr));
+    }
     // Execute mpmetis via system(...)
-    if (exe_metis_flag.getValue())
+    else if (exe_metis_flag.getValue())
     {
         INFO("METIS is running ...");
         const std::string exe_name = argv[0];
@@ -159,11 +227,15 @@ int main(int argc, char* argv[])
             return EXIT_FAILURE;
         }
     }
-    mesh_partitioner.resetPartitionIdsForNodes(
-        readMetisData(input_file_name_wo_extension, num_partitions,
-                      mesh_partitioner.mesh().getNumberOfNodes()));
+    if (!metis_library_flag.getValue())
+    {
+        mesh_partitioner.resetPartitionIdsForNodes(
+            readMetisData(input_file_name_wo_extension, num_partitions,
+                          mesh_partitioner.mesh().getNumberOfNodes()));
 
-    removeMetisPartitioningFiles(input_file_name_wo_extension, num_partitions);
+        removeMetisPartitioningFiles(input_file_name_wo_extension,
+                                     num_partitions);
+    }
 
     INFO("Partitioning the mesh in the node wise way ...");
     bool const is_mixed_high_order_linear_elems = lh_elems_flag.getValue();
@@ -187,6 +187,18 @@ AddTest(
               2Dmesh_POINT5_partitioned_node_properties_val3.bin
 )
 
+# Partitioning balanced by the assembly costs stored as cell property. Only the
+# reading of the weights is checked here; their effect on the partitioning is
+# tested in Tests/ApplicationUtils/TestMetis.cpp.
+AddTest(
+    NAME partmesh_square_4x2_element_weights
+    PATH NodePartitionedMesh/partmesh_element_weights
+    EXECUTABLE partmesh
+    EXECUTABLE_ARGS -m -n 2 -w assembly_cost -i square_4x2_weighted.vtu
+                    -o ${Data_BINARY_DIR}/NodePartitionedMesh/partmesh_element_weights
+    REQUIREMENTS NOT (OGS_USE_MPI OR APPLE)
+)
+
 # Regression test for https://github.com/ufz/ogs/issues/1845 fixed in
 # https://github.com/ufz/ogs/pull/2237
 # checkMesh crashed when encountered Line3 element.
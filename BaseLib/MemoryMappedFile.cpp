@@ -0,0 +1,122 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "MemoryMappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Error.h"
+
+namespace BaseLib
+{
+#ifdef _WIN32
+MemoryMappedFile::MemoryMappedFile(std::string const& file_name)
+{
+    _file_handle =
+        CreateFileA(file_name.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (_file_handle == INVALID_HANDLE_VALUE)
+    {
+        OGS_FATAL("Could not open file '%s' for memory mapping.",
+                  file_name.c_str());
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(_file_handle, &size))
+    {
+        CloseHandle(_file_handle);
+        OGS_FATAL("Could not determine the size of file '%s'.",
+                  file_name.c_str());
+    }
+    _size = static_cast<std::size_t>(size.QuadPart);
+    if (_size == 0)
+    {
+        return;
+    }
+
+    _mapping_handle =
+        CreateFileMappingA(_file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (_mapping_handle == nullptr)
+    {
+        CloseHandle(_file_handle);
+        OGS_FATAL("Could not memory map file '%s'.", file_name.c_str());
+    }
+
+    _data = static_cast<char const*>(
+        MapViewOfFile(_mapping_handle, FILE_MAP_READ, 0, 0, 0));
+    if (_data == nullptr)
+    {
+        CloseHandle(_mapping_handle);
+        CloseHandle(_file_handle);
+        OGS_FATAL("Could not memory map file '%s'.", file_name.c_str());
+    }
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    if (_data != nullptr)
+    {
+        UnmapViewOfFile(_data);
+    }
+    if (_mapping_handle != nullptr)
+    {
+        CloseHandle(_mapping_handle);
+    }
+    CloseHandle(_file_handle);
+}
+#else
+MemoryMappedFile::MemoryMappedFile(std::string const& file_name)
+{
+    int const fd = open(file_name.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        OGS_FATAL("Could not open file '%s' for memory mapping.",
+                  file_name.c_str());
+    }
+
+    struct stat file_status;
+    if (fstat(fd, &file_status) == -1)
+    {
+        close(fd);
+        OGS_FATAL("Could not determine the size of file '%s'.",
+                  file_name.c_str());
+    }
+    _size = static_cast<std::size_t>(file_status.st_size);
+    if (_size == 0)
+    {
+        close(fd);
+        return;
+    }
+
+    void* const data = mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping stays valid after closing the file descriptor.
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        OGS_FATAL("Could not memory map file '%s'.", file_name.c_str());
+    }
+    _data = static_cast<char const*>(data);
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    if (_data != nullptr)
+    {
+        munmap(const_cast<char*>(_data), _size);
+    }
+}
+#endif
+}  // namespace BaseLib
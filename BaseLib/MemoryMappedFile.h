@@ -0,0 +1,47 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace BaseLib
+{
+/// Read-only memory mapping of a whole file.
+///
+/// The operating system reads the pages of the file on first access and may
+/// evict them again under memory pressure. This allows to work with files
+/// larger than the available main memory.
+class MemoryMappedFile final
+{
+public:
+    /// Maps the given file. It is a fatal error if the file can not be opened
+    /// or mapped.
+    explicit MemoryMappedFile(std::string const& file_name);
+
+    MemoryMappedFile(MemoryMappedFile const&) = delete;
+    MemoryMappedFile(MemoryMappedFile&&) = delete;
+    MemoryMappedFile& operator=(MemoryMappedFile const&) = delete;
+    MemoryMappedFile& operator=(MemoryMappedFile&&) = delete;
+
+    ~MemoryMappedFile();
+
+    char const* data() const { return _data; }
+    std::size_t size() const { return _size; }
+
+private:
+    char const* _data = nullptr;
+    std::size_t _size = 0;
+#ifdef _WIN32
+    void* _file_handle = nullptr;
+    void* _mapping_handle = nullptr;
+#endif
+};
+}  // namespace BaseLib
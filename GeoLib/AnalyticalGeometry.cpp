@@ -15,8 +15,10 @@
 #include "AnalyticalGeometry.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <limits>
+#include <numeric>
 
 #include <logog/include/logog.hpp>
 
@@ -341,16 +343,100 @@ std::unique_ptr<GeoLib::Point> triangleLineIntersection(
                                            u * a[2] + v * b[2] + w * c[2]);
 }
 
+namespace
+{
+/// Axis aligned box enlarged by a tolerance used to reject pairs of polylines
+/// and of line segments that can not intersect.
+struct EnlargedBox
+{
+    std::array<double, 3> min;
+    std::array<double, 3> max;
+};
+
+/// Bounding box of the given points enlarged by the tolerance.
+template <typename PointIterator>
+EnlargedBox computeEnlargedBox(PointIterator first, PointIterator last,
+                               double const tolerance)
+{
+    EnlargedBox box{{{std::numeric_limits<double>::max(),
+                      std::numeric_limits<double>::max(),
+                      std::numeric_limits<double>::max()}},
+                    {{std::numeric_limits<double>::lowest(),
+                      std::numeric_limits<double>::lowest(),
+                      std::numeric_limits<double>::lowest()}}};
+    for (; first != last; ++first)
+    {
+        auto const& p = **first;
+        for (int i = 0; i < 3; ++i)
+        {
+            box.min[i] = std::min(box.min[i], p[i]);
+            box.max[i] = std::max(box.max[i], p[i]);
+        }
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+        box.min[i] -= tolerance;
+        box.max[i] += tolerance;
+    }
+    return box;
+}
+
+bool overlap(EnlargedBox const& a, EnlargedBox const& b)
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        if (a.max[i] < b.min[i] || b.max[i] < a.min[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Tolerance by which the bounding boxes of a polyline and its segments are
+/// enlarged. lineSegmentIntersect() accepts intersections of segments having a
+/// distance of up to 1e-6 times the shorter segment length (plus a parameter
+/// overshoot of float epsilon), or end points closer than sqrt(double
+/// epsilon). The tolerance bounds both with a safety margin.
+/// \param box the not enlarged bounding box of the polyline.
+double intersectionTolerance(EnlargedBox const& box)
+{
+    double sqr_diagonal = 0;
+    for (int i = 0; i < 3; ++i)
+    {
+        sqr_diagonal += (box.max[i] - box.min[i]) * (box.max[i] - box.min[i]);
+    }
+    return 1e-5 * std::sqrt(sqr_diagonal) +
+           std::sqrt(std::numeric_limits<double>::epsilon());
+}
+
+EnlargedBox computeEnlargedBox(GeoLib::LineSegment const& segment,
+                               double const tolerance)
+{
+    std::array<GeoLib::Point const*, 2> const pnts{
+        {&segment.getBeginPoint(), &segment.getEndPoint()}};
+    return computeEnlargedBox(pnts.begin(), pnts.end(), tolerance);
+}
+}  // namespace
+
 void computeAndInsertAllIntersectionPoints(GeoLib::PointVec &pnt_vec,
     std::vector<GeoLib::Polyline*> & plys)
 {
     auto computeSegmentIntersections = [&pnt_vec](GeoLib::Polyline& poly0,
-                                                  GeoLib::Polyline& poly1)
+                                                  GeoLib::Polyline& poly1,
+                                                  double const tolerance)
     {
         for (auto seg0_it(poly0.begin()); seg0_it != poly0.end(); ++seg0_it)
         {
+            // The segment is recomputed for each seg1 because inserting an
+            // intersection point shortens it.
             for (auto seg1_it(poly1.begin()); seg1_it != poly1.end(); ++seg1_it)
             {
+                if (!overlap(computeEnlargedBox(*seg0_it, tolerance),
+                             computeEnlargedBox(*seg1_it, 0)))
+                {
+                    continue;
+                }
                 GeoLib::Point s(0.0, 0.0, 0.0, pnt_vec.size());
                 if (lineSegmentIntersect(*seg0_it, *seg1_it, s))
                 {
@@ -363,13 +449,61 @@ void computeAndInsertAllIntersectionPoints(GeoLib::PointVec &pnt_vec,
         }
     };
 
-    for (auto it0(plys.begin()); it0 != plys.end(); ++it0) {
-        auto it1(it0);
-        ++it1;
-        for (; it1 != plys.end(); ++it1) {
-            computeSegmentIntersections(*(*it0), *(*it1));
+    // Inserted intersection points lie on the polylines, therefore the
+    // enlarged boxes computed upfront remain valid.
+    std::vector<double> tolerances;
+    tolerances.reserve(plys.size());
+    std::vector<EnlargedBox> boxes;
+    boxes.reserve(plys.size());
+    for (auto const* ply : plys)
+    {
+        std::vector<GeoLib::Point const*> ply_pnts;
+        ply_pnts.reserve(ply->getNumberOfPoints());
+        for (std::size_t k = 0; k < ply->getNumberOfPoints(); ++k)
+        {
+            ply_pnts.push_back(ply->getPoint(k));
+        }
+        auto const tolerance = intersectionTolerance(
+            computeEnlargedBox(ply_pnts.begin(), ply_pnts.end(), 0));
+        tolerances.push_back(tolerance);
+        boxes.push_back(computeEnlargedBox(ply_pnts.begin(), ply_pnts.end(),
+                                           tolerance));
+    }
+
+    // Sweep along the x-axis over the boxes sorted by their lower x-bound to
+    // find the candidate pairs of polylines with overlapping boxes.
+    std::vector<std::size_t> sorted(plys.size());
+    std::iota(sorted.begin(), sorted.end(), 0);
+    std::sort(sorted.begin(), sorted.end(),
+              [&boxes](std::size_t const a, std::size_t const b) {
+                  return boxes[a].min[0] < boxes[b].min[0];
+              });
+
+    std::vector<std::pair<std::size_t, std::size_t>> candidates;
+    for (auto it0 = sorted.begin(); it0 != sorted.end(); ++it0)
+    {
+        for (auto it1 = std::next(it0);
+             it1 != sorted.end() && boxes[*it1].min[0] <= boxes[*it0].max[0];
+             ++it1)
+        {
+            if (overlap(boxes[*it0], boxes[*it1]))
+            {
+                candidates.emplace_back(std::min(*it0, *it1),
+                                        std::max(*it0, *it1));
+            }
         }
     }
+
+    // Process the candidates in the same order as all pairs were processed
+    // before, such that the resulting point ids and polylines do not depend on
+    // the filtering.
+    std::sort(candidates.begin(), candidates.end());
+    for (auto const& candidate : candidates)
+    {
+        computeSegmentIntersections(
+            *plys[candidate.first], *plys[candidate.second],
+            tolerances[candidate.first] + tolerances[candidate.second]);
+    }
 }
 
 GeoLib::Polygon rotatePolygonToXY(GeoLib::Polygon const& polygon_in,
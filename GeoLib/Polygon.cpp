@@ -14,6 +14,10 @@
 
 #include "Polygon.h"
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
 #include <logog/include/logog.hpp>
 #include <boost/math/constants/constants.hpp>
 
@@ -21,6 +25,89 @@
 
 #include "AnalyticalGeometry.h"
 
+namespace
+{
+/// Edges of a polygon sorted into horizontal slabs of equal height. An edge is
+/// stored in every slab its y-range overlaps, hence all edges whose y-range
+/// contains a given y coordinate are found in the slab of that coordinate.
+class EdgeSlabs final
+{
+public:
+    EdgeSlabs(GeoLib::Polyline const& polygon, double const y_min,
+              double const y_max)
+        : _y_min(y_min),
+          _n_slabs(std::max<std::size_t>(polygon.getNumberOfPoints() - 1, 1)),
+          _inv_slab_height(y_max > y_min ? _n_slabs / (y_max - y_min) : 0.0),
+          _offsets(_n_slabs + 1, 0)
+    {
+        std::size_t const n_edges(polygon.getNumberOfPoints() - 1);
+        // first pass: count the edges per slab, second pass: store them
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            for (std::size_t k(0); k < n_edges; k++)
+            {
+                double const y0((*polygon.getPoint(k))[1]);
+                double const y1((*polygon.getPoint(k + 1))[1]);
+                std::size_t const first(getSlab(std::min(y0, y1)));
+                std::size_t const last(getSlab(std::max(y0, y1)));
+                for (std::size_t s(first); s <= last; ++s)
+                {
+                    if (pass == 0)
+                    {
+                        _offsets[s + 1]++;
+                    }
+                    else
+                    {
+                        _edges[_offsets[s]++] = k;
+                    }
+                }
+            }
+            if (pass == 0)
+            {
+                std::partial_sum(_offsets.begin(), _offsets.end(),
+                                 _offsets.begin());
+                _edges.resize(_offsets.back());
+            }
+        }
+        // the second pass shifted each offset to the begin of the next slab
+        std::copy_backward(_offsets.begin(), _offsets.end() - 1,
+                           _offsets.end());
+        _offsets[0] = 0;
+    }
+
+    template <typename Function>
+    void forEachEdgeInSlabOf(double const y, Function&& f) const
+    {
+        std::size_t const s(getSlab(y));
+        for (std::size_t i(_offsets[s]); i < _offsets[s + 1]; ++i)
+        {
+            if (!f(_edges[i]))
+            {
+                return;
+            }
+        }
+    }
+
+private:
+    /// Monotone mapping of y coordinates to slab numbers.
+    std::size_t getSlab(double const y) const
+    {
+        double const s(std::floor((y - _y_min) * _inv_slab_height));
+        if (!(s > 0))
+        {
+            return 0;
+        }
+        return std::min(static_cast<std::size_t>(s), _n_slabs - 1);
+    }
+
+    double const _y_min;
+    std::size_t const _n_slabs;
+    double const _inv_slab_height;
+    std::vector<std::size_t> _offsets;
+    std::vector<std::size_t> _edges;
+};
+}  // namespace
+
 namespace GeoLib
 {
 Polygon::Polygon(const Polyline &ply, bool init) :
@@ -127,6 +214,79 @@ bool Polygon::isPntInPolygon(double x, double y, double z) const
     return isPntInPolygon (pnt);
 }
 
+std::vector<bool> Polygon::arePntsInPolygon(
+    std::vector<MathLib::Point3d const*> const& pnts) const
+{
+    std::vector<char> inside(pnts.size(), 0);
+    markPntsInPolygon(pnts, std::vector<char>(pnts.size(), 1), inside);
+    return std::vector<bool>(inside.begin(), inside.end());
+}
+
+void Polygon::markPntsInPolygon(
+    std::vector<MathLib::Point3d const*> const& pnts,
+    std::vector<char> const& candidates, std::vector<char>& inside) const
+{
+    MathLib::Point3d const& min_aabb_pnt(_aabb.getMinPoint());
+    MathLib::Point3d const& max_aabb_pnt(_aabb.getMaxPoint());
+    auto const n_pnts = static_cast<long long>(pnts.size());
+
+    std::vector<char> in_aabb(pnts.size(), 0);
+#pragma omp parallel for
+    for (long long k = 0; k < n_pnts; ++k)
+    {
+        MathLib::Point3d const& pnt(*pnts[k]);
+        in_aabb[k] = candidates[k] && !inside[k] &&
+                     !(pnt[0] < min_aabb_pnt[0] || max_aabb_pnt[0] < pnt[0] ||
+                       pnt[1] < min_aabb_pnt[1] || max_aabb_pnt[1] < pnt[1]);
+    }
+
+    if (_simple_polygon_list.size() != 1)
+    {
+        for (auto const* polygon : _simple_polygon_list)
+        {
+            polygon->markPntsInPolygon(pnts, in_aabb, inside);
+        }
+        return;
+    }
+
+    EdgeSlabs const slabs(*this, min_aabb_pnt[1], max_aabb_pnt[1]);
+#pragma omp parallel for
+    for (long long k = 0; k < n_pnts; ++k)
+    {
+        if (!in_aabb[k])
+        {
+            continue;
+        }
+        MathLib::Point3d const& pnt(*pnts[k]);
+        std::size_t n_intersections(0);
+        bool touching(false);
+        slabs.forEachEdgeInSlabOf(pnt[1], [&](std::size_t const e) {
+            double const y0((*getPoint(e))[1]);
+            double const y1((*getPoint(e + 1))[1]);
+            if ((y0 <= pnt[1] && pnt[1] <= y1) ||
+                (y1 <= pnt[1] && pnt[1] <= y0))
+            {
+                switch (getEdgeType(e, pnt))
+                {
+                    case EdgeType::TOUCHING:
+                        touching = true;
+                        return false;
+                    case EdgeType::CROSSING:
+                        n_intersections++;
+                        break;
+                    case EdgeType::INESSENTIAL:
+                        break;
+                }
+            }
+            return true;
+        });
+        if (touching || n_intersections % 2 == 1)
+        {
+            inside[k] = 1;
+        }
+    }
+}
+
 std::vector<GeoLib::Point> Polygon::getAllIntersectionPoints(
         GeoLib::LineSegment const& segment) const
 {
@@ -265,7 +425,8 @@ bool Polygon::getNextIntersectionPointPolygonLine(
     return false;
 }
 
-EdgeType Polygon::getEdgeType (std::size_t k, GeoLib::Point const & pnt) const
+EdgeType Polygon::getEdgeType(std::size_t k,
+                              MathLib::Point3d const& pnt) const
 {
     switch (getLocationOfPoint(k, pnt))
     {
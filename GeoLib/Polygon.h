@@ -74,6 +74,28 @@ public:
      */
     bool isPntInPolygon (double x, double y, double z) const;
 
+    /**
+     * Classifies all given points at once. The result is the same as calling
+     * isPntInPolygon() for every point, but the polygon edges are sorted into
+     * horizontal slabs once, such that each point is only tested against the
+     * edges of its slab. The points are processed in parallel.
+     * @param pnts the points that should be classified
+     * @return vector with entry k set to true iff pnts[k] is inside the
+     * polygon
+     */
+    std::vector<bool> arePntsInPolygon(
+        std::vector<MathLib::Point3d const*> const& pnts) const;
+
+    /// Wrapper for arePntsInPolygon() for vectors of points of derived types,
+    /// for instance mesh nodes.
+    template <typename PointType>
+    std::vector<bool> arePntsInPolygon(
+        std::vector<PointType*> const& pnts) const
+    {
+        return arePntsInPolygon(
+            std::vector<MathLib::Point3d const*>(pnts.begin(), pnts.end()));
+    }
+
     /**
      * Checks if the straight line segment is contained within the polygon.
      * @param segment the straight line segment that is checked with
@@ -125,7 +147,15 @@ private:
      * @param pnt point that is edge type computed for
      * @return a value of enum EdgeType
      */
-    EdgeType getEdgeType (std::size_t k, GeoLib::Point const & pnt) const;
+    EdgeType getEdgeType(std::size_t k, MathLib::Point3d const& pnt) const;
+
+    /**
+     * Sets inside[k] for all points with candidates[k] set that are located
+     * in the polygon. Used by arePntsInPolygon().
+     */
+    void markPntsInPolygon(std::vector<MathLib::Point3d const*> const& pnts,
+                           std::vector<char> const& candidates,
+                           std::vector<char>& inside) const;
 
     void ensureCCWOrientation ();
 
@@ -399,7 +399,8 @@ void Polyline::closePolyline()
     }
 }
 
-Location Polyline::getLocationOfPoint (std::size_t k, GeoLib::Point const & pnt) const
+Location Polyline::getLocationOfPoint(std::size_t k,
+                                      MathLib::Point3d const& pnt) const
 {
     assert (k < _ply_pnt_ids.size() - 1);
 
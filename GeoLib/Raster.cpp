@@ -18,17 +18,48 @@
 #include "Raster.h"
 
 // BaseLib
+#include "BaseLib/Error.h"
 #include "BaseLib/FileTools.h"
+#include "BaseLib/MemoryMappedFile.h"
 #include "BaseLib/StringTools.h"
 
 #include "Triangle.h"
 
 namespace GeoLib {
 
+Raster::Raster(RasterHeader&& header, std::vector<double>&& values)
+    : _header(std::move(header)), _raster_data(std::move(values))
+{
+    if (_raster_data.size() != _header.n_cols * _header.n_rows)
+    {
+        OGS_FATAL(
+            "The number of raster values (%d) does not match the raster "
+            "size given in the header (%d columns x %d rows).",
+            _raster_data.size(), _header.n_cols, _header.n_rows);
+    }
+    _values = _raster_data.data();
+}
+
+Raster::Raster(RasterHeader&& header,
+               std::unique_ptr<BaseLib::MemoryMappedFile>&& mapped_file,
+               std::size_t const offset)
+    : _header(std::move(header)), _mapped_file(std::move(mapped_file))
+{
+    if (offset % alignof(double) != 0 ||
+        _mapped_file->size() <
+            offset + _header.n_cols * _header.n_rows * sizeof(double))
+    {
+        OGS_FATAL(
+            "The memory mapped raster file is too small or the offset of the "
+            "raster values is not aligned.");
+    }
+    _values = reinterpret_cast<double const*>(_mapped_file->data() + offset);
+}
+
 void Raster::refineRaster(std::size_t scaling)
 {
-    auto* new_raster_data(
-        new double[_header.n_rows * _header.n_cols * scaling * scaling]);
+    std::vector<double> new_raster_data(_header.n_rows * _header.n_cols *
+                                        scaling * scaling);
 
     for (std::size_t row(0); row<_header.n_rows; row++) {
         for (std::size_t col(0); col<_header.n_cols; col++) {
@@ -36,24 +67,22 @@ void Raster::refineRaster(std::size_t scaling)
             for (std::size_t new_row(row*scaling); new_row<(row+1)*scaling; new_row++) {
                 const std::size_t idx0(new_row*_header.n_cols*scaling);
                 for (std::size_t new_col(col*scaling); new_col<(col+1)*scaling; new_col++) {
-                    new_raster_data[idx0+new_col] = _raster_data[idx];
+                    new_raster_data[idx0+new_col] = _values[idx];
                 }
             }
         }
     }
 
-    std::swap(_raster_data, new_raster_data);
+    // The refined raster is always held in memory.
+    _raster_data = std::move(new_raster_data);
+    _values = _raster_data.data();
+    _mapped_file.reset();
     _header.cell_size /= scaling;
     _header.n_cols *= scaling;
     _header.n_rows *= scaling;
-
-    delete [] new_raster_data;
 }
 
-Raster::~Raster()
-{
-    delete [] _raster_data;
-}
+Raster::~Raster() = default;
 
 double Raster::getValueAtPoint(const MathLib::Point3d &pnt) const
 {
@@ -75,7 +104,7 @@ double Raster::getValueAtPoint(const MathLib::Point3d &pnt) const
                                          : cell_y);
 
         const std::size_t index = cell_y * _header.n_cols + cell_x;
-        return _raster_data[index];
+        return _values[index];
     }
     return _header.no_data;
 }
@@ -115,9 +144,9 @@ double Raster::interpolateValueAtPoint(MathLib::Point3d const& pnt) const
         }
         else
         {
-            pix_val[j] = _raster_data[static_cast<std::size_t>(yIdx + y_nb[j]) *
-                                          _header.n_cols +
-                                      static_cast<std::size_t>(xIdx + x_nb[j])];
+            pix_val[j] = _values[static_cast<std::size_t>(yIdx + y_nb[j]) *
+                                     _header.n_cols +
+                                 static_cast<std::size_t>(xIdx + x_nb[j])];
         }
 
         // remove no data values
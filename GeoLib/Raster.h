@@ -14,7 +14,11 @@
 #pragma once
 
 #include <array>
+#include <memory>
 #include <utility>
+#include <vector>
+
+#include "BaseLib/MemoryMappedFile.h"
 
 #include "Surface.h"
 
@@ -37,7 +41,9 @@ struct RasterHeader
  * A raster consists of the meta data like number of columns and rows, the lower
  * left point, the size of a raster pixel and a value for invalid data pixels.
  * Additional the object needs the raster data itself. The raster data will be
- * copied from the constructor. The destructor will release the memory.
+ * copied from the constructor. Alternatively the raster data can be read from
+ * a memory mapped file; then only the accessed parts of the raster are paged
+ * into memory by the operating system.
  */
 class Raster {
 public:
@@ -56,11 +62,31 @@ public:
     template <typename InputIterator>
     Raster(RasterHeader&& header, InputIterator begin, InputIterator end)
         : _header(std::move(header)),
-          _raster_data(new double[_header.n_cols * _header.n_rows])
+          _raster_data(_header.n_cols * _header.n_rows)
     {
-        std::copy(begin, end, _raster_data);
+        std::copy(begin, end, _raster_data.begin());
+        _values = _raster_data.data();
     }
 
+    /**
+     * @brief Constructor for an object of class Raster taking over the raster
+     * data without copying them.
+     * @param header meta-information about the raster (height, width, etc.)
+     * @param values raster data, exactly n_cols * n_rows values
+     */
+    Raster(RasterHeader&& header, std::vector<double>&& values);
+
+    /**
+     * @brief Constructor for an object of class Raster reading the raster
+     * data from a memory mapped file.
+     * @param header meta-information about the raster (height, width, etc.)
+     * @param mapped_file file containing the raster data
+     * @param offset position of the first raster value in the file in bytes
+     */
+    Raster(RasterHeader&& header,
+           std::unique_ptr<BaseLib::MemoryMappedFile>&& mapped_file,
+           std::size_t offset);
+
     Raster(Raster const&) = delete;
     Raster(Raster&&) = delete;
     Raster& operator=(Raster const&) = delete;
@@ -78,12 +104,12 @@ public:
      * Constant iterator that is pointing to the first raster pixel value.
      * @return constant iterator
      */
-    const_iterator begin() const { return _raster_data; }
+    const_iterator begin() const { return _values; }
     /**
      * Constant iterator that is pointing to the last raster pixel value.
      * @return constant iterator
      */
-    const_iterator end() const { return _raster_data + _header.n_rows*_header.n_cols; }
+    const_iterator end() const { return _values + _header.n_rows*_header.n_cols; }
 
     /**
      * Returns the raster value at the position of the given point.
@@ -103,7 +129,13 @@ private:
     void setNoDataVal (double no_data_val);
 
     GeoLib::RasterHeader _header;
-    double* _raster_data;
+    /// Raster values if they are held in memory.
+    std::vector<double> _raster_data;
+    /// The file the raster values are read from if they are not held in
+    /// memory.
+    std::unique_ptr<BaseLib::MemoryMappedFile> _mapped_file;
+    /// Points to the first raster value in either of the above storages.
+    double const* _values = nullptr;
 };
 
 }  // namespace GeoLib
@@ -0,0 +1,347 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "EigenAMGPreconditioner.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <logog/include/logog.hpp>
+
+namespace
+{
+using Matrix = MathLib::EigenAMGPreconditioner::Matrix;
+using Vector = MathLib::EigenAMGPreconditioner::Vector;
+using StorageIndex = MathLib::EigenAMGPreconditioner::StorageIndex;
+
+std::size_t const max_levels = 20;
+/// Number of symmetric Gauss-Seidel sweeps on the coarsest level if it is not
+/// solved directly.
+int const coarse_sweeps = 5;
+
+/// Inverse of the diagonal entries, zero for zero diagonal entries.
+Vector invertedDiagonal(Matrix const& A)
+{
+    Vector inverse_diagonal = A.diagonal();
+    for (Eigen::Index i = 0; i < inverse_diagonal.size(); ++i)
+    {
+        inverse_diagonal[i] =
+            inverse_diagonal[i] == 0 ? 0 : 1 / inverse_diagonal[i];
+    }
+    return inverse_diagonal;
+}
+
+/// Gershgorin bound of the spectral radius of \f$ D^{-1} A \f$.
+double estimateSpectralRadius(Matrix const& A, Vector const& inverse_diagonal)
+{
+    double radius = 0;
+    for (StorageIndex i = 0; i < A.outerSize(); ++i)
+    {
+        double row_sum = 0;
+        for (Matrix::InnerIterator it(A, i); it; ++it)
+        {
+            row_sum += std::abs(it.value());
+        }
+        radius = std::max(radius, row_sum * std::abs(inverse_diagonal[i]));
+    }
+    return radius;
+}
+
+/// Groups the nodes of the matrix graph into aggregates of strongly connected
+/// nodes, where the entry \f$ a_{ij} \f$ is strong if
+/// \f$ |a_{ij}| > \varepsilon \sqrt{|a_{ii} a_{jj}|} \f$.
+/// Returns the aggregate of each node, -1 for nodes without strong
+/// connections, which are left out of the coarse levels.
+std::vector<StorageIndex> aggregate(Matrix const& A, double const epsilon,
+                                    StorageIndex& n_aggregates)
+{
+    auto const n = static_cast<StorageIndex>(A.rows());
+    Vector const diagonal = A.diagonal();
+
+    // Strong connections in compressed row format.
+    std::vector<StorageIndex> offsets(n + 1, 0);
+    std::vector<StorageIndex> strong;
+    strong.reserve(A.nonZeros());
+    for (StorageIndex i = 0; i < n; ++i)
+    {
+        for (Matrix::InnerIterator it(A, i); it; ++it)
+        {
+            auto const j = static_cast<StorageIndex>(it.col());
+            if (j != i && it.value() * it.value() >
+                              epsilon * epsilon *
+                                  std::abs(diagonal[i] * diagonal[j]))
+            {
+                strong.push_back(j);
+            }
+        }
+        offsets[i + 1] = static_cast<StorageIndex>(strong.size());
+    }
+
+    StorageIndex const undecided = -2;
+    StorageIndex const isolated = -1;
+    std::vector<StorageIndex> aggregates(n, undecided);
+    for (StorageIndex i = 0; i < n; ++i)
+    {
+        if (offsets[i] == offsets[i + 1])
+        {
+            aggregates[i] = isolated;
+        }
+    }
+
+    // 1. Nodes whose strong neighbours are all free form a new aggregate
+    // together with these neighbours.
+    n_aggregates = 0;
+    for (StorageIndex i = 0; i < n; ++i)
+    {
+        if (aggregates[i] != undecided)
+        {
+            continue;
+        }
+        bool const all_free =
+            std::all_of(strong.begin() + offsets[i],
+                        strong.begin() + offsets[i + 1],
+                        [&](StorageIndex const j) {
+                            return aggregates[j] == undecided;
+                        });
+        if (!all_free)
+        {
+            continue;
+        }
+        aggregates[i] = n_aggregates;
+        for (auto k = offsets[i]; k < offsets[i + 1]; ++k)
+        {
+            aggregates[strong[k]] = n_aggregates;
+        }
+        n_aggregates++;
+    }
+
+    // 2. Remaining nodes join an aggregate of the first step they are
+    // strongly connected to.
+    std::vector<StorageIndex> const first_aggregates = aggregates;
+    for (StorageIndex i = 0; i < n; ++i)
+    {
+        if (aggregates[i] != undecided)
+        {
+            continue;
+        }
+        for (auto k = offsets[i]; k < offsets[i + 1]; ++k)
+        {
+            if (first_aggregates[strong[k]] >= 0)
+            {
+                aggregates[i] = first_aggregates[strong[k]];
+                break;
+            }
+        }
+    }
+
+    // 3. The rest forms new aggregates with their free strong neighbours.
+    for (StorageIndex i = 0; i < n; ++i)
+    {
+        if (aggregates[i] != undecided)
+        {
+            continue;
+        }
+        aggregates[i] = n_aggregates;
+        for (auto k = offsets[i]; k < offsets[i + 1]; ++k)
+        {
+            if (aggregates[strong[k]] == undecided)
+            {
+                aggregates[strong[k]] = n_aggregates;
+            }
+        }
+        n_aggregates++;
+    }
+
+    return aggregates;
+}
+
+/// Computes the prolongator \f$ P = (I - \omega D^{-1} A) T \f$, where \f$ T
+/// \f$ is the piecewise constant interpolation from the aggregates and
+/// \f$ \omega = 4 / (3 \rho(D^{-1} A)) \f$.
+Matrix smoothedProlongator(Matrix const& A, Vector const& inverse_diagonal,
+                           std::vector<StorageIndex> const& aggregates,
+                           StorageIndex const n_aggregates)
+{
+    Matrix T(A.rows(), n_aggregates);
+    T.reserve(Eigen::VectorXi::Ones(A.rows()));
+    for (StorageIndex i = 0; i < A.rows(); ++i)
+    {
+        if (aggregates[i] >= 0)
+        {
+            T.insert(i, aggregates[i]) = 1;
+        }
+    }
+    T.makeCompressed();
+
+    double const omega =
+        4. / (3. * estimateSpectralRadius(A, inverse_diagonal));
+    Matrix const AT = A * T;
+    Matrix P = T - (omega * inverse_diagonal).asDiagonal() * AT;
+    P.makeCompressed();
+    return P;
+}
+
+/// Forward (or backward) Gauss-Seidel sweep for \f$ A x = b \f$.
+void gaussSeidel(Matrix const& A, Vector const& inverse_diagonal,
+                 Vector const& b, Vector& x, bool const forward)
+{
+    auto const n = static_cast<StorageIndex>(A.rows());
+    for (StorageIndex k = 0; k < n; ++k)
+    {
+        auto const i = forward ? k : n - 1 - k;
+        double r = b[i];
+        for (Matrix::InnerIterator it(A, i); it; ++it)
+        {
+            r -= it.value() * x[it.col()];
+        }
+        x[i] += r * inverse_diagonal[i];
+    }
+}
+}  // namespace
+
+namespace MathLib
+{
+bool EigenAMGPreconditioner::isCloseToHierarchyMatrix(Matrix const& A) const
+{
+    if (_levels.size() < 2 || _info != Eigen::Success)
+    {
+        // A single level is the direct solver alone, which must be
+        // recomputed for every matrix.
+        return false;
+    }
+    auto const& B = _levels.front().A;
+    if (A.rows() != B.rows() || A.cols() != B.cols() ||
+        A.nonZeros() != B.nonZeros() ||
+        !std::equal(A.outerIndexPtr(), A.outerIndexPtr() + A.outerSize() + 1,
+                    B.outerIndexPtr()) ||
+        !std::equal(A.innerIndexPtr(), A.innerIndexPtr() + A.nonZeros(),
+                    B.innerIndexPtr()))
+    {
+        return false;
+    }
+
+    auto const nnz = A.nonZeros();
+    Eigen::Map<Vector const> const a(A.valuePtr(), nnz);
+    return (a - _hierarchy_values).norm() <=
+           rebuild_tolerance * _hierarchy_values.norm();
+}
+
+void EigenAMGPreconditioner::setup(Matrix&& A)
+{
+    A.makeCompressed();
+    if (isCloseToHierarchyMatrix(A))
+    {
+        DBUG("-> AMG: reuse the hierarchy of the previous setup");
+        // Only the coarse levels are kept; the smoother on the finest level
+        // uses the new matrix.
+        _levels.front().A = std::move(A);
+        _levels.front().inverse_diagonal = invertedDiagonal(_levels.front().A);
+        return;
+    }
+
+    _levels.clear();
+    _levels.emplace_back();
+    _levels.back().A = std::move(A);
+    _levels.back().inverse_diagonal = invertedDiagonal(_levels.back().A);
+    _hierarchy_values = Eigen::Map<Vector const>(
+        _levels.back().A.valuePtr(), _levels.back().A.nonZeros());
+
+    double epsilon = 0.08;
+    while (_levels.back().A.rows() > max_coarse_size &&
+           _levels.size() < max_levels)
+    {
+        auto& fine = _levels.back();
+        StorageIndex n_aggregates = 0;
+        auto const aggregates = aggregate(fine.A, epsilon, n_aggregates);
+        // Stop if the coarsening stagnates.
+        if (n_aggregates == 0 || n_aggregates > 0.9 * fine.A.rows())
+        {
+            break;
+        }
+
+        fine.P = smoothedProlongator(fine.A, fine.inverse_diagonal, aggregates,
+                                     n_aggregates);
+        fine.R = fine.P.transpose();
+        Matrix coarse_A = fine.R * (fine.A * fine.P);
+        coarse_A.makeCompressed();
+
+        _levels.emplace_back();
+        _levels.back().A = std::move(coarse_A);
+        _levels.back().inverse_diagonal = invertedDiagonal(_levels.back().A);
+        epsilon *= 0.5;
+    }
+
+    _use_coarse_solver = false;
+    if (_levels.back().A.rows() > max_coarse_size)
+    {
+        WARN(
+            "AMG: the coarsening stopped at %d rows, which is more than the "
+            "%d rows solved directly. Using Gauss-Seidel sweeps on the "
+            "coarsest level instead.",
+            static_cast<int>(_levels.back().A.rows()), max_coarse_size);
+    }
+    else
+    {
+        _coarse_solver.compute(Eigen::SparseMatrix<double>(_levels.back().A));
+        _use_coarse_solver = _coarse_solver.info() == Eigen::Success;
+        if (!_use_coarse_solver)
+        {
+            WARN(
+                "AMG: LU decomposition of the coarsest level failed, using "
+                "Gauss-Seidel sweeps instead.");
+        }
+    }
+
+    double n_rows = 0;
+    double n_nonzeros = 0;
+    for (auto const& level : _levels)
+    {
+        n_rows += level.A.rows();
+        n_nonzeros += level.A.nonZeros();
+    }
+    INFO(
+        "-> AMG: %d levels, %d coarsest rows, grid complexity %g, operator "
+        "complexity %g",
+        _levels.size(), _levels.back().A.rows(),
+        n_rows / _levels.front().A.rows(),
+        n_nonzeros / _levels.front().A.nonZeros());
+
+    _info = Eigen::Success;
+}
+
+void EigenAMGPreconditioner::cycle(std::size_t const level, Vector const& b,
+                                   Vector& x) const
+{
+    auto const& l = _levels[level];
+    if (level + 1 == _levels.size())
+    {
+        if (_use_coarse_solver)
+        {
+            x = _coarse_solver.solve(b);
+            return;
+        }
+        for (int i = 0; i < coarse_sweeps; ++i)
+        {
+            gaussSeidel(l.A, l.inverse_diagonal, b, x, true);
+            gaussSeidel(l.A, l.inverse_diagonal, b, x, false);
+        }
+        return;
+    }
+
+    gaussSeidel(l.A, l.inverse_diagonal, b, x, true);
+
+    Vector const coarse_b = l.R * (b - l.A * x);
+    Vector coarse_x = Vector::Zero(coarse_b.size());
+    cycle(level + 1, coarse_b, coarse_x);
+    x += l.P * coarse_x;
+
+    gaussSeidel(l.A, l.inverse_diagonal, b, x, false);
+}
+
+}  // namespace MathLib
@@ -0,0 +1,128 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <Eigen/Sparse>
+#include <Eigen/SparseLU>
+
+namespace MathLib
+{
+/// Smoothed aggregation algebraic multigrid preconditioner for Eigen's
+/// iterative solvers.
+///
+/// The hierarchy is built from the strong connections of the matrix
+/// entries: nodes are grouped into aggregates, the piecewise constant
+/// tentative prolongator is smoothed by one damped Jacobi step and the coarse
+/// operators are the Galerkin products \f$ A_c = P^T A P \f$. The coarsest
+/// level is solved by a sparse LU decomposition if it has at most
+/// \c max_coarse_size rows, otherwise (if the coarsening stagnates) by
+/// symmetric Gauss-Seidel sweeps. One application of the
+/// preconditioner is a V-cycle with one forward Gauss-Seidel sweep before and
+/// one backward sweep after the coarse grid correction; hence the
+/// preconditioner is symmetric for symmetric matrices and can be used with
+/// the CG method.
+///
+/// The aggregation uses the scalar near null space (constant vector) and is
+/// therefore suited for scalar problems like groundwater flow or heat
+/// transport.
+///
+/// The setup is expensive compared to a single V-cycle. Therefore, the
+/// hierarchy is kept as long as the sparsity pattern of the matrix is
+/// unchanged and its values do not deviate by more than
+/// \c rebuild_tolerance from the values used for the last setup (relative
+/// change in the Frobenius norm). The smoother on the finest level always
+/// uses the current matrix.
+class EigenAMGPreconditioner
+{
+public:
+    using Matrix = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+    using Vector = Eigen::VectorXd;
+    using StorageIndex = Matrix::StorageIndex;
+
+    /// Relative change of the matrix triggering a rebuild of the hierarchy.
+    static constexpr double rebuild_tolerance = 0.1;
+
+    /// Coarsening stops at this number of rows. Larger coarsest levels are
+    /// not factorized.
+    static constexpr StorageIndex max_coarse_size = 1000;
+
+    EigenAMGPreconditioner() = default;
+
+    template <typename MatrixType>
+    explicit EigenAMGPreconditioner(MatrixType const& A)
+    {
+        compute(A);
+    }
+
+    template <typename MatrixType>
+    EigenAMGPreconditioner& analyzePattern(MatrixType const& /*A*/)
+    {
+        return *this;
+    }
+
+    template <typename MatrixType>
+    EigenAMGPreconditioner& factorize(MatrixType const& A)
+    {
+        setup(Matrix(A));
+        return *this;
+    }
+
+    template <typename MatrixType>
+    EigenAMGPreconditioner& compute(MatrixType const& A)
+    {
+        return factorize(A);
+    }
+
+    /// Applies one V-cycle to the given vector.
+    template <typename Rhs>
+    Vector solve(Eigen::MatrixBase<Rhs> const& b) const
+    {
+        Vector x = Vector::Zero(b.size());
+        cycle(0, b, x);
+        return x;
+    }
+
+    Eigen::ComputationInfo info() const { return _info; }
+
+    /// Number of levels of the multigrid hierarchy including the finest one.
+    std::size_t getNumberOfLevels() const { return _levels.size(); }
+
+private:
+    struct Level
+    {
+        Matrix A;
+        Vector inverse_diagonal;
+        /// Prolongation to this level from the next coarser level.
+        Matrix P;
+        /// Restriction from this level to the next coarser level.
+        Matrix R;
+    };
+
+    void setup(Matrix&& A);
+    bool isCloseToHierarchyMatrix(Matrix const& A) const;
+    void cycle(std::size_t const level, Vector const& b, Vector& x) const;
+
+    std::vector<Level> _levels;
+
+    /// Values of the finest matrix the hierarchy was built from.
+    Vector _hierarchy_values;
+
+    /// Direct solver on the coarsest level.
+    Eigen::SparseLU<Eigen::SparseMatrix<double>> _coarse_solver;
+    /// If the coarsest matrix is too large or singular, Gauss-Seidel sweeps
+    /// are used instead of the direct solver.
+    bool _use_coarse_solver = false;
+
+    Eigen::ComputationInfo _info = Eigen::Success;
+};
+
+}  // namespace MathLib
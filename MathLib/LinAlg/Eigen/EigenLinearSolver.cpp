@@ -9,6 +9,8 @@
 
 #include "EigenLinearSolver.h"
 
+#include <algorithm>
+
 #include <logog/include/logog.hpp>
 
 #ifdef USE_MKL
@@ -22,6 +24,8 @@
 #endif
 
 #include "BaseLib/ConfigTree.h"
+#include "EigenAMGPreconditioner.h"
+#include "EigenMatrixFreeOperator.h"
 #include "EigenVector.h"
 #include "EigenMatrix.h"
 #include "EigenTools.h"
@@ -42,6 +46,73 @@ public:
 
     //! Solves the linear equation system \f$ A x = b \f$ for \f$ x \f$.
     virtual bool solve(Matrix &A, Vector const& b, Vector &x, EigenOption &opt) = 0;
+
+    //! Number of factorizations or preconditioner computations so far.
+    std::size_t getNumberOfInitializations() const
+    {
+        return _number_of_initializations;
+    }
+
+protected:
+    //! Computes the factorization or the preconditioner of the \c solver for
+    //! the compressed matrix \c A.
+    //!
+    //! If EigenOption::reuse_factorization is set, a copy of \c A is kept and
+    //! the solver is initialized with that copy. The initialization is skipped
+    //! if a subsequent call passes a matrix equal to the copy, e.g., when the
+    //! same operator is solved for several right-hand sides one after another.
+    template <typename Solver>
+    bool initialize(Solver& solver, Matrix const& A, EigenOption const& opt)
+    {
+        if (!opt.reuse_factorization)
+        {
+            solver.compute(A);
+            ++_number_of_initializations;
+        }
+        else if (isEqualToFactorizedMatrix(A))
+        {
+            INFO("-> reuse the initialization of the previous solve");
+            return true;
+        }
+        else
+        {
+            _factorized_matrix = A;
+            solver.compute(_factorized_matrix);
+            ++_number_of_initializations;
+        }
+
+        if (solver.info() != Eigen::Success)
+        {
+            _factorized_matrix.resize(0, 0);
+            ERR("Failed during Eigen linear solver initialization");
+            return false;
+        }
+        return true;
+    }
+
+private:
+    bool isEqualToFactorizedMatrix(Matrix const& A) const
+    {
+        auto const& B = _factorized_matrix;
+        if (A.rows() != B.rows() || A.cols() != B.cols() ||
+            A.nonZeros() != B.nonZeros() || B.rows() == 0)
+        {
+            return false;
+        }
+        auto const n_outer = A.outerSize() + 1;
+        auto const nnz = A.nonZeros();
+        return std::equal(A.outerIndexPtr(), A.outerIndexPtr() + n_outer,
+                          B.outerIndexPtr()) &&
+               std::equal(A.innerIndexPtr(), A.innerIndexPtr() + nnz,
+                          B.innerIndexPtr()) &&
+               std::equal(A.valuePtr(), A.valuePtr() + nnz, B.valuePtr());
+    }
+
+    //! Copy of the matrix of the last initialization, only used with
+    //! EigenOption::reuse_factorization.
+    Matrix _factorized_matrix;
+
+    std::size_t _number_of_initializations = 0;
 };
 
 namespace details
@@ -61,9 +132,8 @@ public:
             A.makeCompressed();
         }
 
-        _solver.compute(A);
-        if(_solver.info()!=Eigen::Success) {
-            ERR("Failed during Eigen linear solver initialization");
+        if (!initialize(_solver, A, opt))
+        {
             return false;
         }
 
@@ -98,9 +168,8 @@ public:
             A.makeCompressed();
         }
 
-        _solver.compute(A);
-        if(_solver.info()!=Eigen::Success) {
-            ERR("Failed during Eigen linear solver initialization");
+        if (!initialize(_solver, A, opt))
+        {
             return false;
         }
 
@@ -144,6 +213,8 @@ std::unique_ptr<EigenLinearSolverBase> createIterativeSolver(
             // see https://eigen.tuxfamily.org/dox/classEigen_1_1IncompleteLUT.html
             return createIterativeSolver<
                 Solver, Eigen::IncompleteLUT<double>>();
+        case EigenOption::PreconType::AMG:
+            return createIterativeSolver<Solver, EigenAMGPreconditioner>();
         default:
             OGS_FATAL("Invalid Eigen preconditioner type.");
     }
@@ -176,6 +247,174 @@ std::unique_ptr<EigenLinearSolverBase> createIterativeSolver(
     }
 }
 
+template <template <typename, typename> class Solver, typename Precon>
+bool solveMatrixFree(EigenMatrixFreeOperator const& A,
+                     EigenLinearSolverBase::Vector const& b,
+                     EigenLinearSolverBase::Vector& x, EigenOption const& opt)
+{
+    Solver<EigenMatrixFreeOperator, Precon> solver;
+    solver.setTolerance(opt.error_tolerance);
+    solver.setMaxIterations(opt.max_iterations);
+    solver.compute(A);
+
+    x = solver.solveWithGuess(b, x);
+    INFO("\t iteration: %d/%ld", solver.iterations(), opt.max_iterations);
+    INFO("\t residual: %e\n", solver.error());
+
+    if (solver.info() != Eigen::Success)
+    {
+        ERR("Failed during Eigen linear solve");
+        return false;
+    }
+    return true;
+}
+
+template <template <typename, typename> class Solver>
+bool solveMatrixFree(EigenMatrixFreeOperator const& A,
+                     EigenLinearSolverBase::Vector const& b,
+                     EigenLinearSolverBase::Vector& x, EigenOption const& opt)
+{
+    switch (opt.precon_type)
+    {
+        case EigenOption::PreconType::NONE:
+            return solveMatrixFree<Solver, Eigen::IdentityPreconditioner>(
+                A, b, x, opt);
+        case EigenOption::PreconType::DIAGONAL:
+            return solveMatrixFree<Solver,
+                                   EigenMatrixFreeDiagonalPreconditioner>(
+                A, b, x, opt);
+        default:
+            OGS_FATAL(
+                "The Eigen preconditioner %s needs an assembled matrix. Use "
+                "NONE or DIAGONAL for matrix-free operators.",
+                EigenOption::getPreconName(opt.precon_type).c_str());
+    }
+}
+
+// The operator is not split into triangular parts, hence both are used.
+template <typename Mat, typename Precon>
+using EigenMatrixFreeCGSolver =
+    Eigen::ConjugateGradient<Mat, Eigen::Lower | Eigen::Upper, Precon>;
+
+/// Solves the linear equation system \f$ A x = b \f$ only for the unknowns
+/// that are coupled with other unknowns.
+///
+/// Rows of \c A that have no non-zero off-diagonal entry, e.g., the ones of
+/// d.o.f.s pinned by applyKnownSolution() in deactivated subdomains, are
+/// solved directly. Their values are moved to the right-hand side of the
+/// remaining rows and only that reduced system is passed to the \c solver.
+/// Thereby the cost of the linear solver depends on the size of the active
+/// part of the system only.
+bool solveWithoutPinnedDofs(EigenLinearSolverBase& solver,
+                            EigenLinearSolverBase::Matrix& A,
+                            EigenLinearSolverBase::Vector const& b,
+                            EigenLinearSolverBase::Vector& x,
+                            EigenOption& opt)
+{
+    using Matrix = EigenLinearSolverBase::Matrix;
+    using Vector = EigenLinearSolverBase::Vector;
+    using Index = Matrix::StorageIndex;
+    static_assert(Matrix::IsRowMajor, "matrix is assumed to be row major!");
+
+    if (!A.isCompressed())
+    {
+        A.makeCompressed();
+    }
+
+    auto const n = static_cast<Index>(A.rows());
+
+    // Index of each row in the reduced system, -1 for pinned rows.
+    std::vector<Index> reduced_index(n, -1);
+    Index n_active = 0;
+    for (Index r = 0; r < n; ++r)
+    {
+        double diagonal = 0.0;
+        bool coupled = false;
+        for (Matrix::InnerIterator it(A, r); it; ++it)
+        {
+            if (it.col() == r)
+            {
+                diagonal = it.value();
+            }
+            else if (it.value() != 0.0)
+            {
+                coupled = true;
+                break;
+            }
+        }
+
+        // Singular rows are kept, such that the solver reports them.
+        if (coupled || diagonal == 0.0)
+        {
+            reduced_index[r] = n_active++;
+        }
+        else
+        {
+            x[r] = b[r] / diagonal;
+        }
+    }
+
+    if (n_active == n)
+    {
+        return solver.solve(A, b, x, opt);
+    }
+
+    INFO("-> eliminated %d pinned d.o.f.s, %d d.o.f.s remaining", n - n_active,
+         n_active);
+
+    Eigen::VectorXi non_zeros_per_row(n_active);
+    Vector b_active(n_active);
+    Vector x_active(n_active);
+    for (Index r = 0; r < n; ++r)
+    {
+        auto const r_active = reduced_index[r];
+        if (r_active < 0)
+        {
+            continue;
+        }
+        non_zeros_per_row[r_active] =
+            A.outerIndexPtr()[r + 1] - A.outerIndexPtr()[r];
+        b_active[r_active] = b[r];
+        x_active[r_active] = x[r];
+    }
+
+    Matrix A_active(n_active, n_active);
+    A_active.reserve(non_zeros_per_row);
+    for (Index r = 0; r < n; ++r)
+    {
+        auto const r_active = reduced_index[r];
+        if (r_active < 0)
+        {
+            continue;
+        }
+        for (Matrix::InnerIterator it(A, r); it; ++it)
+        {
+            auto const c_active = reduced_index[it.col()];
+            if (c_active < 0)
+            {
+                b_active[r_active] -= it.value() * x[it.col()];
+                continue;
+            }
+            A_active.insert(r_active, c_active) = it.value();
+        }
+    }
+    A_active.makeCompressed();
+
+    if (!solver.solve(A_active, b_active, x_active, opt))
+    {
+        return false;
+    }
+
+    for (Index r = 0; r < n; ++r)
+    {
+        if (reduced_index[r] >= 0)
+        {
+            x[r] = x_active[reduced_index[r]];
+        }
+    }
+    return true;
+}
+
 }  // namespace details
 
 EigenLinearSolver::EigenLinearSolver(
@@ -253,6 +492,19 @@ void EigenLinearSolver::setOption(BaseLib::ConfigTree const& option)
             ptSolver->getConfigParameterOptional<int>("max_iteration_step")) {
         _option.max_iterations = *max_iteration_step;
     }
+    if (auto eliminate_pinned_dofs =
+            //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__eliminate_pinned_dofs}
+            ptSolver->getConfigParameterOptional<bool>(
+                "eliminate_pinned_dofs"))
+    {
+        _option.eliminate_pinned_dofs = *eliminate_pinned_dofs;
+    }
+    if (auto reuse_factorization =
+            //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__reuse_factorization}
+            ptSolver->getConfigParameterOptional<bool>("reuse_factorization"))
+    {
+        _option.reuse_factorization = *reuse_factorization;
+    }
     if (auto scaling =
             //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__scaling}
             ptSolver->getConfigParameterOptional<bool>("scaling")) {
@@ -282,8 +534,13 @@ bool EigenLinearSolver::solve(EigenMatrix &A, EigenVector& b, EigenVector &x)
         b.getRawVector() = scal->LeftScaling().cwiseProduct(b.getRawVector());
     }
 #endif
-    auto const success = _solver->solve(A.getRawMatrix(), b.getRawVector(),
-                                        x.getRawVector(), _option);
+    auto const success =
+        _option.eliminate_pinned_dofs
+            ? details::solveWithoutPinnedDofs(*_solver, A.getRawMatrix(),
+                                              b.getRawVector(),
+                                              x.getRawVector(), _option)
+            : _solver->solve(A.getRawMatrix(), b.getRawVector(),
+                             x.getRawVector(), _option);
 #ifdef USE_EIGEN_UNSUPPORTED
     if (scal)
     {
@@ -296,4 +553,44 @@ bool EigenLinearSolver::solve(EigenMatrix &A, EigenVector& b, EigenVector &x)
     return success;
 }
 
+std::size_t EigenLinearSolver::getNumberOfInitializations() const
+{
+    return _solver->getNumberOfInitializations();
+}
+
+bool EigenLinearSolver::solve(MatrixFreeOperator<EigenVector> const& A,
+                              EigenVector& b, EigenVector& x)
+{
+    INFO("------------------------------------------------------------------");
+    INFO("*** Eigen solver computation (matrix-free)");
+    INFO("-> solve with %s (precon %s)",
+         EigenOption::getSolverName(_option.solver_type).c_str(),
+         EigenOption::getPreconName(_option.precon_type).c_str());
+
+    EigenMatrixFreeOperator const A_eigen(A, b.size());
+
+    bool success = false;
+    switch (_option.solver_type)
+    {
+        case EigenOption::SolverType::BiCGSTAB:
+            success = details::solveMatrixFree<Eigen::BiCGSTAB>(
+                A_eigen, b.getRawVector(), x.getRawVector(), _option);
+            break;
+        case EigenOption::SolverType::CG:
+            success =
+                details::solveMatrixFree<details::EigenMatrixFreeCGSolver>(
+                    A_eigen, b.getRawVector(), x.getRawVector(), _option);
+            break;
+        default:
+            OGS_FATAL(
+                "The Eigen linear solver %s cannot be used with matrix-free "
+                "operators. Use CG or BiCGSTAB.",
+                EigenOption::getSolverName(_option.solver_type).c_str());
+    }
+
+    INFO("------------------------------------------------------------------");
+
+    return success;
+}
+
 }  // namespace MathLib
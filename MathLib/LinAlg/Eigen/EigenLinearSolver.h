@@ -20,6 +20,9 @@ namespace MathLib
 class EigenMatrix;
 class EigenVector;
 
+template <typename Vector>
+class MatrixFreeOperator;
+
 class EigenLinearSolverBase;
 
 class EigenLinearSolver final
@@ -55,6 +58,16 @@ public:
 
     bool solve(EigenMatrix &A, EigenVector& b, EigenVector &x);
 
+    /// Solves \f$ A x = b \f$ for an operator \f$ A \f$ that is not
+    /// assembled. Only the iterative solvers with no or the diagonal
+    /// preconditioner can be used.
+    bool solve(MatrixFreeOperator<EigenVector> const& A, EigenVector& b,
+               EigenVector& x);
+
+    /// Returns how often the factorization or the preconditioner has been
+    /// computed, cf. EigenOption::reuse_factorization.
+    std::size_t getNumberOfInitializations() const;
+
 protected:
     EigenOption _option;
     std::unique_ptr<EigenLinearSolverBase> _solver;
@@ -0,0 +1,164 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <Eigen/Sparse>
+
+#include "EigenVector.h"
+#include "MathLib/LinAlg/MatrixFreeOperator.h"
+
+namespace MathLib
+{
+class EigenMatrixFreeOperator;
+}  // namespace MathLib
+
+namespace Eigen
+{
+namespace internal
+{
+// The operator behaves like a sparse matrix towards Eigen's iterative solvers.
+template <>
+struct traits<MathLib::EigenMatrixFreeOperator>
+    : public traits<Eigen::SparseMatrix<double>>
+{
+};
+}  // namespace internal
+}  // namespace Eigen
+
+namespace MathLib
+{
+/// Adapts a MatrixFreeOperator to the matrix interface needed by Eigen's
+/// iterative solvers, i.e., the product with a dense vector.
+class EigenMatrixFreeOperator
+    : public Eigen::EigenBase<EigenMatrixFreeOperator>
+{
+public:
+    using Scalar = double;
+    using RealScalar = double;
+    using StorageIndex = int;
+    enum
+    {
+        ColsAtCompileTime = Eigen::Dynamic,
+        MaxColsAtCompileTime = Eigen::Dynamic,
+        IsRowMajor = false
+    };
+
+    EigenMatrixFreeOperator(MatrixFreeOperator<EigenVector> const& op,
+                            Eigen::Index const size)
+        : _op(op), _x(size), _y(size)
+    {
+    }
+
+    Eigen::Index rows() const { return _x.size(); }
+    Eigen::Index cols() const { return _x.size(); }
+
+    template <typename Rhs>
+    Eigen::Product<EigenMatrixFreeOperator, Rhs, Eigen::AliasFreeProduct>
+    operator*(Eigen::MatrixBase<Rhs> const& x) const
+    {
+        return Eigen::Product<EigenMatrixFreeOperator, Rhs,
+                              Eigen::AliasFreeProduct>(*this, x.derived());
+    }
+
+    /// Computes \f$ y = y + \alpha A x \f$.
+    template <typename Dest, typename Rhs>
+    void scaleAndAddTo(Dest& y, Rhs const& x, double const alpha) const
+    {
+        _x.getRawVector() = x;
+        _op.apply(_x, _y);
+        y.noalias() += alpha * _y.getRawVector();
+    }
+
+    EigenVector::RawVectorType diagonal() const
+    {
+        _op.getDiagonal(_y);
+        return _y.getRawVector();
+    }
+
+private:
+    MatrixFreeOperator<EigenVector> const& _op;
+
+    // Buffers for the operator's arguments.
+    mutable EigenVector _x;
+    mutable EigenVector _y;
+};
+
+/// Jacobi preconditioner for Eigen's iterative solvers, which takes the
+/// diagonal from the operator instead of iterating over matrix entries.
+class EigenMatrixFreeDiagonalPreconditioner
+{
+public:
+    using Vector = Eigen::VectorXd;
+
+    EigenMatrixFreeDiagonalPreconditioner() = default;
+
+    template <typename MatrixType>
+    explicit EigenMatrixFreeDiagonalPreconditioner(MatrixType const& A)
+    {
+        compute(A);
+    }
+
+    template <typename MatrixType>
+    EigenMatrixFreeDiagonalPreconditioner& analyzePattern(
+        MatrixType const& /*A*/)
+    {
+        return *this;
+    }
+
+    template <typename MatrixType>
+    EigenMatrixFreeDiagonalPreconditioner& factorize(MatrixType const& A)
+    {
+        // Rows without diagonal entry are left unscaled.
+        _inverse_diagonal = A.diagonal().unaryExpr(
+            [](double const d) { return d == 0.0 ? 1.0 : 1.0 / d; });
+        return *this;
+    }
+
+    template <typename MatrixType>
+    EigenMatrixFreeDiagonalPreconditioner& compute(MatrixType const& A)
+    {
+        return factorize(A);
+    }
+
+    template <typename Rhs>
+    Vector solve(Eigen::MatrixBase<Rhs> const& b) const
+    {
+        return _inverse_diagonal.cwiseProduct(b.derived());
+    }
+
+    Eigen::ComputationInfo info() const { return Eigen::Success; }
+
+private:
+    Vector _inverse_diagonal;
+};
+
+}  // namespace MathLib
+
+namespace Eigen
+{
+namespace internal
+{
+template <typename Rhs>
+struct generic_product_impl<MathLib::EigenMatrixFreeOperator, Rhs,
+                            SparseShape, DenseShape, GemvProduct>
+    : generic_product_impl_base<
+          MathLib::EigenMatrixFreeOperator, Rhs,
+          generic_product_impl<MathLib::EigenMatrixFreeOperator, Rhs>>
+{
+    template <typename Dest>
+    static void scaleAndAddTo(Dest& dst,
+                              MathLib::EigenMatrixFreeOperator const& lhs,
+                              Rhs const& rhs, double const& alpha)
+    {
+        lhs.scaleAndAddTo(dst, rhs, alpha);
+    }
+};
+}  // namespace internal
+}  // namespace Eigen
@@ -19,6 +19,8 @@ EigenOption::EigenOption()
     precon_type = PreconType::NONE;
     max_iterations = static_cast<int>(1e6);
     error_tolerance = 1.e-16;
+    eliminate_pinned_dofs = false;
+    reuse_factorization = false;
 #ifdef USE_EIGEN_UNSUPPORTED
     scaling = false;
 #endif
@@ -64,6 +66,10 @@ EigenOption::PreconType EigenOption::getPreconType(const std::string &precon_nam
     {
         return PreconType::ILUT;
     }
+    if (precon_name == "AMG")
+    {
+        return PreconType::AMG;
+    }
 
     OGS_FATAL("Unknown Eigen preconditioner type `%s'", precon_name.c_str());
 }
@@ -94,6 +100,8 @@ std::string EigenOption::getPreconName(PreconType const precon_type)
             return "DIAGONAL";
         case PreconType::ILUT:
             return "ILUT";
+        case PreconType::AMG:
+            return "AMG";
     }
     return "Invalid";
 }
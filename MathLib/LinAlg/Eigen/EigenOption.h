@@ -32,7 +32,8 @@ struct EigenOption final
     {
         NONE,
         DIAGONAL,
-        ILUT
+        ILUT,
+        AMG
     };
 
     /// Linear solver type
@@ -43,6 +44,13 @@ struct EigenOption final
     int max_iterations;
     /// Error tolerance
     double error_tolerance;
+    /// Eliminate d.o.f.s which are decoupled from the rest of the system,
+    /// e.g., the ones of deactivated subdomains, before solving.
+    bool eliminate_pinned_dofs;
+    /// Keep the factorization or preconditioner and reuse it as long as the
+    /// matrix does not change, e.g., for several transported components
+    /// sharing one transport operator.
+    bool reuse_factorization;
 #ifdef USE_EIGEN_UNSUPPORTED
     /// Scaling the coefficient matrix and the RHS bector
     bool scaling;
@@ -15,6 +15,7 @@
 #include <logog/include/logog.hpp>
 
 #include "BaseLib/ConfigTree.h"
+#include "BaseLib/Error.h"
 #include "MathLib/LinAlg/Eigen/EigenMatrix.h"
 #include "MathLib/LinAlg/Eigen/EigenVector.h"
 #include "MathLib/LinAlg/Lis/LisMatrix.h"
@@ -59,4 +60,12 @@ bool EigenLisLinearSolver::solve(EigenMatrix &A_, EigenVector& b_,
     return status;
 }
 
+bool EigenLisLinearSolver::solve(MatrixFreeOperator<EigenVector> const& /*A*/,
+                                 EigenVector& /*b*/, EigenVector& /*x*/)
+{
+    OGS_FATAL(
+        "The Lis linear solver cannot be used with matrix-free operators. "
+        "Use the Eigen or PETSc linear solvers instead.");
+}
+
 } //MathLib
@@ -22,6 +22,9 @@ namespace MathLib
 class EigenVector;
 class EigenMatrix;
 
+template <typename Vector>
+class MatrixFreeOperator;
+
 /**
  * Linear solver using Lis library with Eigen matrix and vector objects
  */
@@ -46,6 +49,10 @@ public:
 
     bool solve(EigenMatrix &A, EigenVector& b, EigenVector &x);
 
+    /// Lis needs assembled matrices, therefore this always fails.
+    bool solve(MatrixFreeOperator<EigenVector> const& A, EigenVector& b,
+               EigenVector& x);
+
 private:
     LisOption _lis_option;
 };
@@ -157,6 +157,11 @@ void matMultAdd(PETScMatrix const& A, PETScVector const& v1,
     MatMultAdd(A.getRawMatrix(), v1.getRawVector(), v2.getRawVector(), v3.getRawVector());
 }
 
+void getDiagonal(PETScMatrix const& A, PETScVector& d)
+{
+    MatGetDiagonal(A.getRawMatrix(), d.getRawVector());
+}
+
 void finalizeAssembly(PETScMatrix& A)
 {
     A.finalizeAssembly(MAT_FINAL_ASSEMBLY);
@@ -303,6 +308,11 @@ void matMultAdd(EigenMatrix const& A, EigenVector const& v1, EigenVector const&
     v3.getRawVector() = v2.getRawVector() + A.getRawMatrix()*v1.getRawVector();
 }
 
+void getDiagonal(EigenMatrix const& A, EigenVector& d)
+{
+    d.getRawVector() = A.getRawMatrix().diagonal();
+}
+
 void finalizeAssembly(EigenMatrix& x)
 {
     x.getRawMatrix().makeCompressed();
@@ -188,6 +188,9 @@ void matMult(PETScMatrix const& A, PETScVector const& x, PETScVector& y);
 void matMultAdd(PETScMatrix const& A, PETScVector const& v1,
                        PETScVector const& v2, PETScVector& v3);
 
+// d = diag(A)
+void getDiagonal(PETScMatrix const& A, PETScVector& d);
+
 void finalizeAssembly(PETScMatrix& A);
 void finalizeAssembly(PETScVector& x);
 
@@ -256,6 +259,9 @@ void matMult(EigenMatrix const& A, EigenVector const& x, EigenVector& y);
 void matMultAdd(EigenMatrix const& A, EigenVector const& v1,
                 EigenVector const& v2, EigenVector& v3);
 
+// d = diag(A)
+void getDiagonal(EigenMatrix const& A, EigenVector& d);
+
 void finalizeAssembly(EigenMatrix& x);
 void finalizeAssembly(EigenVector& A);
 
@@ -0,0 +1,33 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+namespace MathLib
+{
+/// A linear operator \f$ A \f$ that is applied to vectors without assembling
+/// its matrix, e.g., element by element.
+///
+/// Iterative linear solvers only need the product \f$ y = A x \f$ and, for
+/// Jacobi preconditioning, the diagonal of \f$ A \f$.
+template <typename Vector>
+class MatrixFreeOperator
+{
+public:
+    virtual ~MatrixFreeOperator() = default;
+
+    /// Computes \f$ y = A x \f$. The vector \c y must have the same layout as
+    /// \c x.
+    virtual void apply(Vector const& x, Vector& y) const = 0;
+
+    /// Writes the diagonal of \f$ A \f$ to \c d.
+    virtual void getDiagonal(Vector& d) const = 0;
+};
+
+}  // namespace MathLib
@@ -9,18 +9,37 @@
 
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include "GlobalMatrixVectorTypes.h"
 
 namespace MathLib
 {
+/// The rows of one field, e.g., of one primary variable, of a coupled system
+/// of equations. Used to set up block preconditioners.
+struct FieldSplit
+{
+    std::string name;
+    /// Ascending global indices of the rows owned by this rank.
+    std::vector<GlobalIndexType> indices;
+    /// Number of consecutive indices belonging to the same mesh node, i.e.,
+    /// the number of components of the field, or one if the components are
+    /// not stored consecutively.
+    int block_size = 1;
+};
 
 struct MatrixSpecifications
 {
     MatrixSpecifications(std::size_t const nrows_, std::size_t const ncols_,
                          std::vector<GlobalIndexType> const*const ghost_indices_,
-                         GlobalSparsityPattern const*const sparsity_pattern_)
+                         GlobalSparsityPattern const*const sparsity_pattern_,
+                         std::vector<FieldSplit> const* const field_splits_ =
+                             nullptr,
+                         int const block_size_ = 1)
         : nrows(nrows_), ncols(ncols_), ghost_indices(ghost_indices_)
-        , sparsity_pattern(sparsity_pattern_)
+        , sparsity_pattern(sparsity_pattern_), field_splits(field_splits_)
+        , block_size(block_size_)
     {
     }
 
@@ -28,6 +47,11 @@ struct MatrixSpecifications
     std::size_t const ncols;
     std::vector<GlobalIndexType> const*const ghost_indices;
     GlobalSparsityPattern const*const sparsity_pattern;
+    /// Optional row layout of the fields of a coupled system.
+    std::vector<FieldSplit> const* const field_splits;
+    /// Number of consecutive rows and columns forming a block, e.g., all
+    /// d.o.f.s of one mesh node if they are numbered consecutively.
+    int const block_size;
 };
 
 } // namespace MathLib
@@ -36,6 +36,7 @@ newInstance(MatrixSpecifications const& spec)
     auto const nrows = spec.nrows;
     auto const ncols = spec.ncols;
 
+    std::unique_ptr<PETScMatrix> A;
     if (spec.sparsity_pattern)
     {
         // Assert that the misuse of the sparsity pattern is consistent.
@@ -47,10 +48,22 @@ newInstance(MatrixSpecifications const& spec)
         mat_opt.d_nz = max_nonzeroes;
         mat_opt.o_nz = max_nonzeroes;
         mat_opt.is_global_size = false;
-        return std::make_unique<PETScMatrix>(nrows, ncols, mat_opt);
+        mat_opt.block_size = spec.block_size;
+        A = std::make_unique<PETScMatrix>(nrows, ncols, mat_opt);
     }
     else
-        return std::make_unique<PETScMatrix>(nrows, ncols);
+    {
+        // Without a sparsity pattern, e.g., for the mostly empty matrices of
+        // matrix-free processes, the nonzeros are allocated on insertion.
+        PETScMatrixOption mat_opt;
+        mat_opt.is_global_size = false;
+        mat_opt.block_size = spec.block_size;
+        mat_opt.new_nonzero_allocation_error = false;
+        A = std::make_unique<PETScMatrix>(nrows, ncols, mat_opt);
+    }
+
+    A->setFieldSplits(spec.field_splits);
+    return A;
 }
 
 std::unique_ptr<PETScVector>
@@ -17,6 +17,7 @@
 #include "PETScLinearSolver.h"
 #include "BaseLib/RunTime.h"
 #include "MathLib/LinAlg/LinearSolverOptions.h"
+#include "MathLib/LinAlg/MatrixSpecifications.h"
 
 namespace MathLib
 {
@@ -72,7 +73,91 @@ PETScLinearSolver::PETScLinearSolver(const std::string /*prefix*/,
     KSPSetFromOptions(_solver);  // set run-time options
 }
 
+namespace
+{
+/// Context of the shell matrix wrapping a MatrixFreeOperator.
+struct MatrixFreeOperatorContext
+{
+    MatrixFreeOperatorContext(MatrixFreeOperator<PETScVector> const& op_,
+                              PETScVector const& layout)
+        : op(op_), x(layout, false), y(layout, false)
+    {
+    }
+
+    MatrixFreeOperator<PETScVector> const& op;
+
+    // Copies of the arguments having the ghost layout the operator expects.
+    PETScVector x;
+    PETScVector y;
+};
+
+PetscErrorCode applyMatrixFreeOperator(Mat A, Vec x, Vec y)
+{
+    MatrixFreeOperatorContext* context;
+    MatShellGetContext(A, &context);
+
+    VecCopy(x, context->x.getRawVector());
+    context->op.apply(context->x, context->y);
+    VecCopy(context->y.getRawVector(), y);
+    return 0;
+}
+
+PetscErrorCode getMatrixFreeOperatorDiagonal(Mat A, Vec d)
+{
+    MatrixFreeOperatorContext* context;
+    MatShellGetContext(A, &context);
+
+    context->op.getDiagonal(context->y);
+    VecCopy(context->y.getRawVector(), d);
+    return 0;
+}
+}  // namespace
+
 bool PETScLinearSolver::solve(PETScMatrix& A, PETScVector& b, PETScVector& x)
+{
+#if (PETSC_VERSION_NUMBER > 3040)
+    KSPSetOperators(_solver, A.getRawMatrix(), A.getRawMatrix());
+#else
+    KSPSetOperators(_solver, A.getRawMatrix(), A.getRawMatrix(),
+                    DIFFERENT_NONZERO_PATTERN);
+#endif
+
+    if (!_field_splits_set || A.getFieldSplits() != _field_splits)
+    {
+        setFieldSplits(A);
+    }
+
+    return solve(b, x);
+}
+
+bool PETScLinearSolver::solve(MatrixFreeOperator<PETScVector> const& A,
+                              PETScVector& b, PETScVector& x)
+{
+    MatrixFreeOperatorContext context(A, b);
+
+    Mat A_shell;
+    MatCreateShell(PETSC_COMM_WORLD, b.getLocalSize(), b.getLocalSize(),
+                   b.size(), b.size(), &context, &A_shell);
+    MatShellSetOperation(A_shell, MATOP_MULT,
+                         reinterpret_cast<void (*)(void)>(
+                             &applyMatrixFreeOperator));
+    MatShellSetOperation(A_shell, MATOP_GET_DIAGONAL,
+                         reinterpret_cast<void (*)(void)>(
+                             &getMatrixFreeOperatorDiagonal));
+
+#if (PETSC_VERSION_NUMBER > 3040)
+    KSPSetOperators(_solver, A_shell, A_shell);
+#else
+    KSPSetOperators(_solver, A_shell, A_shell, DIFFERENT_NONZERO_PATTERN);
+#endif
+
+    bool const converged = solve(b, x);
+
+    MatDestroy(&A_shell);
+    return converged;
+}
+
+bool PETScLinearSolver::solve(PETScVector& b, PETScVector& x)
 {
     BaseLib::RunTime wtimer;
     wtimer.start();
@@ -83,13 +168,6 @@ bool PETScLinearSolver::solve(PETScMatrix& A, PETScVector& b, PETScVector& x)
     PetscMemoryGetCurrentUsage(&mem1);
 #endif
 
-#if (PETSC_VERSION_NUMBER > 3040)
-    KSPSetOperators(_solver, A.getRawMatrix(), A.getRawMatrix());
-#else
-    KSPSetOperators(_solver, A.getRawMatrix(), A.getRawMatrix(),
-                    DIFFERENT_NONZERO_PATTERN);
-#endif
-
     KSPSolve(_solver, b.getRawVector(), x.getRawVector());
 
     KSPConvergedReason reason;
@@ -187,4 +265,51 @@ bool PETScLinearSolver::solve(PETScMatrix& A, PETScVector& b, PETScVector& x)
     return converged;
 }
 
+void PETScLinearSolver::setFieldSplits(PETScMatrix const& A)
+{
+    bool const replace_field_splits = _field_splits_set;
+    _field_splits_set = true;
+    _field_splits = A.getFieldSplits();
+
+    PetscBool is_field_split;
+    PetscObjectTypeCompare(reinterpret_cast<PetscObject>(_pc), PCFIELDSPLIT,
+                           &is_field_split);
+    if (!is_field_split)
+    {
+        return;
+    }
+
+    if (replace_field_splits)
+    {
+        // The index sets of a set up field split preconditioner cannot be
+        // changed. Changing the type destroys the old splits and sub-solvers;
+        // the options are read again.
+        PCSetType(_pc, PCNONE);
+        PCSetType(_pc, PCFIELDSPLIT);
+        PCSetFromOptions(_pc);
+    }
+
+    if (_field_splits == nullptr || _field_splits->empty())
+    {
+        return;
+    }
+
+    for (auto const& field_split : *_field_splits)
+    {
+        IS is;
+        ISCreateGeneral(PETSC_COMM_WORLD,
+                        static_cast<PetscInt>(field_split.indices.size()),
+                        field_split.indices.data(), PETSC_COPY_VALUES, &is);
+        if (field_split.block_size > 1)
+        {
+            ISSetBlockSize(is, field_split.block_size);
+        }
+        PCFieldSplitSetIS(_pc, field_split.name.c_str(), is);
+        ISDestroy(&is);
+
+        INFO("PETSc field split '%s' with %d local rows.",
+             field_split.name.c_str(), field_split.indices.size());
+    }
+}
+
 }  // end of namespace
@@ -24,6 +24,7 @@
 
 #include "BaseLib/ConfigTree.h"
 
+#include "MathLib/LinAlg/MatrixFreeOperator.h"
 #include "PETScMatrix.h"
 #include "PETScVector.h"
 
@@ -54,6 +55,14 @@ public:
     // TODO check if some args in LinearSolver interface can be made const&.
     bool solve(PETScMatrix& A, PETScVector& b, PETScVector& x);
 
+    /// Solves \f$ A x = b \f$ for an operator \f$ A \f$ that is not
+    /// assembled. The operator is wrapped into a shell matrix, which
+    /// supports the matrix-vector product and the extraction of the
+    /// diagonal; hence only preconditioners relying on these operations,
+    /// e.g., \c jacobi or \c none, can be used.
+    bool solve(MatrixFreeOperator<PETScVector> const& A, PETScVector& b,
+               PETScVector& x);
+
     /// Get number of iterations.
     PetscInt getNumberOfIterations() const
     {
@@ -65,9 +74,26 @@ public:
     /// Get elapsed wall clock time.
     double getElapsedTime() const { return _elapsed_ctime; }
 private:
+    /// Solves with the operators set before and reports the convergence.
+    bool solve(PETScVector& b, PETScVector& x);
+
+    /// Passes the field splits of the matrix as index sets to the
+    /// preconditioner if it is of type PCFIELDSPLIT. The splits are named
+    /// after the fields, so that the options of the sub-solvers can be given
+    /// with the prefix \c fieldsplit_<field name>_.
+    /// If other splits have been set before, e.g., if the solver is shared
+    /// by several processes, the preconditioner is set up anew.
+    void setFieldSplits(PETScMatrix const& A);
+
     KSP _solver;  ///< Solver type.
     PC _pc;       ///< Preconditioner type.
 
+    /// The index sets of the field split preconditioner can only be set
+    /// before its setup; they are kept until the field splits change.
+    bool _field_splits_set = false;
+    /// The field splits passed to the preconditioner.
+    std::vector<FieldSplit> const* _field_splits = nullptr;
+
     double _elapsed_ctime = 0.0;  ///< Clock time
 };
 
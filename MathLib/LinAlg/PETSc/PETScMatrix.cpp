@@ -32,7 +32,8 @@ PETScMatrix::PETScMatrix(const PetscInt nrows, const PETScMatrixOption& mat_opt)
         _ncols = PETSC_DECIDE;
     }
 
-    create(mat_opt.d_nz, mat_opt.o_nz);
+    create(mat_opt.d_nz, mat_opt.o_nz, mat_opt.block_size,
+           mat_opt.new_nonzero_allocation_error);
 }
 
 PETScMatrix::PETScMatrix(const PetscInt nrows, const PetscInt ncols,
@@ -50,7 +51,8 @@ PETScMatrix::PETScMatrix(const PetscInt nrows, const PetscInt ncols,
         _n_loc_cols = ncols;
     }
 
-    create(mat_opt.d_nz, mat_opt.o_nz);
+    create(mat_opt.d_nz, mat_opt.o_nz, mat_opt.block_size,
+           mat_opt.new_nonzero_allocation_error);
 }
 
 PETScMatrix::PETScMatrix(const PETScMatrix& A)
@@ -59,7 +61,8 @@ PETScMatrix::PETScMatrix(const PETScMatrix& A)
       _n_loc_rows(A._n_loc_rows),
       _n_loc_cols(A._n_loc_cols),
       _start_rank(A._start_rank),
-      _end_rank(A._end_rank)
+      _end_rank(A._end_rank),
+      _field_splits(A._field_splits)
 {
     MatConvert(A._A, MATSAME, MAT_INITIAL_MATRIX, &_A);
 }
@@ -72,6 +75,7 @@ PETScMatrix& PETScMatrix::operator=(PETScMatrix const& A)
     _n_loc_cols = A._n_loc_cols;
     _start_rank = A._start_rank;
     _end_rank = A._end_rank;
+    _field_splits = A._field_splits;
 
     if (_A)
     {
@@ -131,10 +135,16 @@ void PETScMatrix::viewer(const std::string& file_name,
 #endif
 }
 
-void PETScMatrix::create(const PetscInt d_nz, const PetscInt o_nz)
+void PETScMatrix::create(const PetscInt d_nz, const PetscInt o_nz,
+                         const PetscInt block_size,
+                         const bool new_nonzero_allocation_error)
 {
     MatCreate(PETSC_COMM_WORLD, &_A);
     MatSetSizes(_A, _n_loc_rows, _n_loc_cols, _nrows, _ncols);
+    if (block_size > 1)
+    {
+        MatSetBlockSizes(_A, block_size, block_size);
+    }
 
     MatSetFromOptions(_A);
 
@@ -143,6 +153,10 @@ void PETScMatrix::create(const PetscInt d_nz, const PetscInt o_nz)
     MatMPIAIJSetPreallocation(_A, d_nz, PETSC_NULL, o_nz, PETSC_NULL);
     // If pre-allocation does not work one can use MatSetUp(_A), which is much
     // slower.
+    if (!new_nonzero_allocation_error)
+    {
+        MatSetOption(_A, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE);
+    }
 
     MatGetOwnershipRange(_A, &_start_rank, &_end_rank);
     MatGetSize(_A, &_nrows, &_ncols);
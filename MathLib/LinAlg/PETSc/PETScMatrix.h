@@ -26,6 +26,8 @@ typedef Mat PETSc_Mat;
 
 namespace MathLib
 {
+struct FieldSplit;
+
 /*!
    \brief Wrapper class for PETSc matrix routines for matrix.
 */
@@ -60,6 +62,20 @@ public:
 
     PETScMatrix& operator=(PETScMatrix const& A);
 
+    /// Sets the row layout of the fields of a coupled system, which is passed
+    /// to field split preconditioners. The field splits are not copied and
+    /// must outlive the matrix.
+    void setFieldSplits(std::vector<FieldSplit> const* const field_splits)
+    {
+        _field_splits = field_splits;
+    }
+
+    /// Returns the row layout of the fields or nullptr if not set.
+    std::vector<FieldSplit> const* getFieldSplits() const
+    {
+        return _field_splits;
+    }
+
     /*!
        \brief          Perform MPI collection of assembled entries in buffer
        \param asm_type Assmebly type, either MAT_FLUSH_ASSEMBLY
@@ -237,6 +253,9 @@ private:
     /// Ending index in a rank
     PetscInt _end_rank;
 
+    /// Row layout of the fields of a coupled system.
+    std::vector<FieldSplit> const* _field_splits = nullptr;
+
     /*!
       \brief Create the matrix, configure memory allocation and set the
       related member data.
@@ -244,8 +263,13 @@ private:
                   local submatrix (same value is used for all local rows),
       \param o_nz Number of nonzeros per row in the off-diagonal portion of
                   local submatrix (same value is used for all local rows)
+      \param block_size Row and column block size of the matrix.
+      \param new_nonzero_allocation_error If false, insertions outside of the
+                  preallocation are allowed.
     */
-    void create(const PetscInt d_nz, const PetscInt o_nz);
+    void create(const PetscInt d_nz, const PetscInt o_nz,
+                const PetscInt block_size,
+                const bool new_nonzero_allocation_error);
 
     friend bool finalizeMatrixAssembly(PETScMatrix& mat,
                                        const MatAssemblyType asm_type);
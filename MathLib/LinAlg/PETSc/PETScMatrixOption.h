@@ -27,7 +27,9 @@ struct PETScMatrixOption
         : is_global_size(true),
           n_local_cols(PETSC_DECIDE),
           d_nz(PETSC_DECIDE),
-          o_nz(PETSC_DECIDE)
+          o_nz(PETSC_DECIDE),
+          block_size(1),
+          new_nonzero_allocation_error(true)
     {
     }
 
@@ -56,6 +58,16 @@ struct PETScMatrixOption
             (same value is used for all local rows), the default is PETSC_DECIDE
     */
     PetscInt o_nz;
+
+    /// Row and column block size of the matrix, see MatSetBlockSizes(). The
+    /// numbers of local rows and columns must be divisible by it.
+    PetscInt block_size;
+
+    /// If false, entries outside of the preallocated nonzeros are allocated
+    /// on insertion instead of raising an error, see
+    /// MAT_NEW_NONZERO_ALLOCATION_ERR. For matrices whose sparsity pattern is
+    /// not known in advance. The default is true.
+    bool new_nonzero_allocation_error;
 };
 
 }  // end namespace
@@ -46,12 +46,8 @@ std::vector<bool> markNodesOutSideOfPolygon(
     );
 
     // *** mark rotated nodes
-    std::vector<bool> outside(rotated_nodes.size(), true);
-    for (std::size_t k(0); k<rotated_nodes.size(); k++) {
-        if (rot_polygon.isPntInPolygon(*(rotated_nodes[k]))) {
-            outside[k] = false;
-        }
-    }
+    std::vector<bool> outside(rot_polygon.arePntsInPolygon(rotated_nodes));
+    outside.flip();
 
     for (auto& rotated_node : rotated_nodes)
     {
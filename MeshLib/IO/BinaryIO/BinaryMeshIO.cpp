@@ -0,0 +1,548 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "BinaryMeshIO.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/FileTools.h"
+#include "BaseLib/MemoryMappedFile.h"
+
+#include "MeshLib/Elements/Elements.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshEnums.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/Properties.h"
+
+namespace
+{
+char const magic[8] = {'O', 'G', 'S', '-', 'B', 'M', 'S', 'H'};
+std::uint64_t const byte_order_mark = 0x0102030405060708;
+std::uint64_t const format_version = 1;
+
+/// Type codes of the supported property value types.
+template <typename T>
+struct ValueType;
+template <>
+struct ValueType<double>
+{
+    static constexpr std::uint64_t code = 0;
+};
+template <>
+struct ValueType<float>
+{
+    static constexpr std::uint64_t code = 1;
+};
+template <>
+struct ValueType<int>
+{
+    static constexpr std::uint64_t code = 2;
+};
+template <>
+struct ValueType<unsigned>
+{
+    static constexpr std::uint64_t code = 3;
+};
+template <>
+struct ValueType<std::size_t>
+{
+    static constexpr std::uint64_t code = 4;
+};
+template <>
+struct ValueType<char>
+{
+    static constexpr std::uint64_t code = 5;
+};
+
+std::size_t paddedSize(std::size_t const n_bytes)
+{
+    return (n_bytes + 7) / 8 * 8;
+}
+
+void writeBytes(std::ostream& os, void const* data, std::size_t const n_bytes)
+{
+    os.write(static_cast<char const*>(data), n_bytes);
+    std::array<char, 8> const zeros{};
+    os.write(zeros.data(), paddedSize(n_bytes) - n_bytes);
+}
+
+void writeUInt64(std::ostream& os, std::uint64_t const value)
+{
+    writeBytes(os, &value, sizeof(value));
+}
+
+template <typename T>
+bool writeProperty(std::ostream& os, MeshLib::Properties const& properties,
+                   std::string const& name)
+{
+    if (!properties.existsPropertyVector<T>(name))
+    {
+        return false;
+    }
+    auto const& property = *properties.getPropertyVector<T>(name);
+    writeUInt64(os, name.size());
+    writeBytes(os, name.data(), name.size());
+    writeUInt64(os, static_cast<std::uint64_t>(property.getMeshItemType()));
+    writeUInt64(os, ValueType<T>::code);
+    writeUInt64(os, property.getNumberOfComponents());
+    writeUInt64(os, property.size());
+    writeBytes(os, property.data(), property.size() * sizeof(T));
+    return true;
+}
+
+/// Sequential access to the sections of a mapped file. Each section starts at
+/// an 8 byte boundary.
+class SectionReader final
+{
+public:
+    explicit SectionReader(BaseLib::MemoryMappedFile const& file)
+        : _data(file.data()), _size(file.size())
+    {
+    }
+
+    /// Returns a pointer to the next n values of type T or nullptr if the file
+    /// is too short.
+    template <typename T>
+    T const* next(std::size_t const n)
+    {
+        std::size_t const n_bytes = n * sizeof(T);
+        if (n_bytes / sizeof(T) != n || _size - _position < n_bytes)
+        {
+            return nullptr;
+        }
+        auto const* values = reinterpret_cast<T const*>(_data + _position);
+        _position += paddedSize(n_bytes);
+        _position = std::min(_position, _size);
+        return values;
+    }
+
+    bool nextUInt64(std::uint64_t& value)
+    {
+        auto const* p = next<std::uint64_t>(1);
+        if (p == nullptr)
+        {
+            return false;
+        }
+        value = *p;
+        return true;
+    }
+
+private:
+    char const* const _data;
+    std::size_t const _size;
+    std::size_t _position = 0;
+};
+
+template <typename T>
+bool readProperty(SectionReader& reader, std::uint64_t const value_type,
+                  std::string const& name,
+                  MeshLib::MeshItemType const item_type,
+                  std::size_t const n_components, std::size_t const n_values,
+                  MeshLib::Properties& properties)
+{
+    if (value_type != ValueType<T>::code)
+    {
+        return false;
+    }
+    auto const* values = reader.next<T>(n_values);
+    if (values == nullptr)
+    {
+        ERR("readBinaryMesh(): Unexpected end of file in property '%s'.",
+            name.c_str());
+        return false;
+    }
+    auto* property =
+        properties.createNewPropertyVector<T>(name, item_type, n_components);
+    if (property == nullptr)
+    {
+        WARN("readBinaryMesh(): Could not create property '%s'.",
+             name.c_str());
+        return true;
+    }
+    property->assign(values, values + n_values);
+    return true;
+}
+
+MeshLib::Element* createElement(MeshLib::CellType const cell_type,
+                                MeshLib::Node** nodes, std::size_t const id)
+{
+    switch (cell_type)
+    {
+        case MeshLib::CellType::POINT1:
+            return new MeshLib::Point(nodes, id);
+        case MeshLib::CellType::LINE2:
+            return new MeshLib::Line(nodes, id);
+        case MeshLib::CellType::LINE3:
+            return new MeshLib::Line3(nodes, id);
+        case MeshLib::CellType::TRI3:
+            return new MeshLib::Tri(nodes, id);
+        case MeshLib::CellType::TRI6:
+            return new MeshLib::Tri6(nodes, id);
+        case MeshLib::CellType::QUAD4:
+            return new MeshLib::Quad(nodes, id);
+        case MeshLib::CellType::QUAD8:
+            return new MeshLib::Quad8(nodes, id);
+        case MeshLib::CellType::QUAD9:
+            return new MeshLib::Quad9(nodes, id);
+        case MeshLib::CellType::TET4:
+            return new MeshLib::Tet(nodes, id);
+        case MeshLib::CellType::TET10:
+            return new MeshLib::Tet10(nodes, id);
+        case MeshLib::CellType::HEX8:
+            return new MeshLib::Hex(nodes, id);
+        case MeshLib::CellType::HEX20:
+            return new MeshLib::Hex20(nodes, id);
+        case MeshLib::CellType::PRISM6:
+            return new MeshLib::Prism(nodes, id);
+        case MeshLib::CellType::PRISM15:
+            return new MeshLib::Prism15(nodes, id);
+        case MeshLib::CellType::PYRAMID5:
+            return new MeshLib::Pyramid(nodes, id);
+        case MeshLib::CellType::PYRAMID13:
+            return new MeshLib::Pyramid13(nodes, id);
+        default:
+            return nullptr;
+    }
+}
+
+/// Number of nodes of the given cell type, zero for unsupported types.
+unsigned getNumberOfNodes(MeshLib::CellType const cell_type)
+{
+    switch (cell_type)
+    {
+        case MeshLib::CellType::POINT1:
+            return MeshLib::Point::n_all_nodes;
+        case MeshLib::CellType::LINE2:
+            return MeshLib::Line::n_all_nodes;
+        case MeshLib::CellType::LINE3:
+            return MeshLib::Line3::n_all_nodes;
+        case MeshLib::CellType::TRI3:
+            return MeshLib::Tri::n_all_nodes;
+        case MeshLib::CellType::TRI6:
+            return MeshLib::Tri6::n_all_nodes;
+        case MeshLib::CellType::QUAD4:
+            return MeshLib::Quad::n_all_nodes;
+        case MeshLib::CellType::QUAD8:
+            return MeshLib::Quad8::n_all_nodes;
+        case MeshLib::CellType::QUAD9:
+            return MeshLib::Quad9::n_all_nodes;
+        case MeshLib::CellType::TET4:
+            return MeshLib::Tet::n_all_nodes;
+        case MeshLib::CellType::TET10:
+            return MeshLib::Tet10::n_all_nodes;
+        case MeshLib::CellType::HEX8:
+            return MeshLib::Hex::n_all_nodes;
+        case MeshLib::CellType::HEX20:
+            return MeshLib::Hex20::n_all_nodes;
+        case MeshLib::CellType::PRISM6:
+            return MeshLib::Prism::n_all_nodes;
+        case MeshLib::CellType::PRISM15:
+            return MeshLib::Prism15::n_all_nodes;
+        case MeshLib::CellType::PYRAMID5:
+            return MeshLib::Pyramid::n_all_nodes;
+        case MeshLib::CellType::PYRAMID13:
+            return MeshLib::Pyramid13::n_all_nodes;
+        default:
+            return 0;
+    }
+}
+
+/// Checks the cell types and the connectivity. Returns false if an element is
+/// invalid.
+bool checkElements(std::uint64_t const n_nodes, std::uint64_t const n_elements,
+                   std::uint8_t const* const cell_types,
+                   std::uint64_t const* const offsets,
+                   std::uint64_t const* const connectivity,
+                   std::uint64_t const n_connectivity)
+{
+    if (offsets[0] != 0 || offsets[n_elements] != n_connectivity)
+    {
+        ERR("readBinaryMesh(): Invalid element offsets.");
+        return false;
+    }
+    for (std::uint64_t e = 0; e < n_elements; ++e)
+    {
+        auto const n_elem_nodes =
+            getNumberOfNodes(static_cast<MeshLib::CellType>(cell_types[e]));
+        if (n_elem_nodes == 0)
+        {
+            ERR("readBinaryMesh(): Element %llu has unsupported cell type "
+                "%d.",
+                static_cast<unsigned long long>(e),
+                static_cast<int>(cell_types[e]));
+            return false;
+        }
+        if (offsets[e + 1] < offsets[e] ||
+            offsets[e + 1] - offsets[e] != n_elem_nodes)
+        {
+            ERR("readBinaryMesh(): Element %llu has a wrong number of nodes.",
+                static_cast<unsigned long long>(e));
+            return false;
+        }
+    }
+    for (std::uint64_t i = 0; i < n_connectivity; ++i)
+    {
+        if (connectivity[i] >= n_nodes)
+        {
+            ERR("readBinaryMesh(): Node id %llu in the connectivity is out of "
+                "range.",
+                static_cast<unsigned long long>(connectivity[i]));
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+namespace MeshLib
+{
+namespace IO
+{
+MeshLib::Mesh* readBinaryMesh(std::string const& file_name)
+{
+    if (!BaseLib::IsFileExisting(file_name))
+    {
+        ERR("File '%s' does not exist.", file_name.c_str());
+        return nullptr;
+    }
+
+    BaseLib::MemoryMappedFile const file(file_name);
+    SectionReader reader(file);
+
+    auto const* file_magic = reader.next<char>(sizeof(magic));
+    std::uint64_t bom = 0;
+    std::uint64_t version = 0;
+    if (file_magic == nullptr ||
+        std::memcmp(file_magic, magic, sizeof(magic)) != 0 ||
+        !reader.nextUInt64(bom) || !reader.nextUInt64(version))
+    {
+        ERR("readBinaryMesh(): '%s' is not a binary mesh file.",
+            file_name.c_str());
+        return nullptr;
+    }
+    if (bom != byte_order_mark)
+    {
+        ERR("readBinaryMesh(): '%s' was written on a machine with different "
+            "byte order.",
+            file_name.c_str());
+        return nullptr;
+    }
+    if (version != format_version)
+    {
+        ERR("readBinaryMesh(): Unsupported format version %llu in '%s'.",
+            static_cast<unsigned long long>(version), file_name.c_str());
+        return nullptr;
+    }
+
+    std::uint64_t n_nodes = 0;
+    std::uint64_t n_elements = 0;
+    std::uint64_t n_connectivity = 0;
+    std::uint64_t n_properties = 0;
+    if (!reader.nextUInt64(n_nodes) || !reader.nextUInt64(n_elements) ||
+        !reader.nextUInt64(n_connectivity) || !reader.nextUInt64(n_properties))
+    {
+        ERR("readBinaryMesh(): Unexpected end of file in header of '%s'.",
+            file_name.c_str());
+        return nullptr;
+    }
+
+    auto const* coords = reader.next<double>(3 * n_nodes);
+    auto const* cell_types = reader.next<std::uint8_t>(n_elements);
+    auto const* offsets = reader.next<std::uint64_t>(n_elements + 1);
+    auto const* connectivity = reader.next<std::uint64_t>(n_connectivity);
+    if (coords == nullptr || cell_types == nullptr || offsets == nullptr ||
+        connectivity == nullptr)
+    {
+        ERR("readBinaryMesh(): Unexpected end of file in mesh data of '%s'.",
+            file_name.c_str());
+        return nullptr;
+    }
+    if (!checkElements(n_nodes, n_elements, cell_types, offsets, connectivity,
+                       n_connectivity))
+    {
+        return nullptr;
+    }
+
+    auto const n_nodes_ll = static_cast<long long>(n_nodes);
+    std::vector<MeshLib::Node*> nodes(n_nodes);
+#pragma omp parallel for
+    for (long long i = 0; i < n_nodes_ll; ++i)
+    {
+        nodes[i] = new MeshLib::Node(coords[3 * i], coords[3 * i + 1],
+                                     coords[3 * i + 2], i);
+    }
+
+    auto const n_elements_ll = static_cast<long long>(n_elements);
+    std::vector<MeshLib::Element*> elements(n_elements);
+#pragma omp parallel for
+    for (long long e = 0; e < n_elements_ll; ++e)
+    {
+        std::size_t const n_elem_nodes = offsets[e + 1] - offsets[e];
+        auto** elem_nodes = new MeshLib::Node*[n_elem_nodes];
+        for (std::size_t k = 0; k < n_elem_nodes; ++k)
+        {
+            elem_nodes[k] = nodes[connectivity[offsets[e] + k]];
+        }
+        elements[e] = createElement(
+            static_cast<MeshLib::CellType>(cell_types[e]), elem_nodes, e);
+    }
+
+    auto* mesh = new MeshLib::Mesh(
+        BaseLib::extractBaseNameWithoutExtension(file_name), nodes, elements);
+
+    // The property vectors are filled directly from the mapped file.
+    for (std::uint64_t p = 0; p < n_properties; ++p)
+    {
+        std::uint64_t name_length = 0;
+        char const* name_data = nullptr;
+        std::uint64_t item_type = 0;
+        std::uint64_t value_type = 0;
+        std::uint64_t n_components = 0;
+        std::uint64_t n_values = 0;
+        if (!reader.nextUInt64(name_length) ||
+            (name_data = reader.next<char>(name_length)) == nullptr ||
+            !reader.nextUInt64(item_type) || !reader.nextUInt64(value_type) ||
+            !reader.nextUInt64(n_components) || !reader.nextUInt64(n_values))
+        {
+            ERR("readBinaryMesh(): Unexpected end of file in properties of "
+                "'%s'.",
+                file_name.c_str());
+            delete mesh;
+            return nullptr;
+        }
+        std::string const name(name_data, name_length);
+        auto const mesh_item_type = static_cast<MeshLib::MeshItemType>(item_type);
+        auto& properties = mesh->getProperties();
+
+        if (!readProperty<double>(reader, value_type, name, mesh_item_type,
+                                  n_components, n_values, properties) &&
+            !readProperty<float>(reader, value_type, name, mesh_item_type,
+                                 n_components, n_values, properties) &&
+            !readProperty<int>(reader, value_type, name, mesh_item_type,
+                               n_components, n_values, properties) &&
+            !readProperty<unsigned>(reader, value_type, name, mesh_item_type,
+                                    n_components, n_values, properties) &&
+            !readProperty<std::size_t>(reader, value_type, name,
+                                       mesh_item_type, n_components, n_values,
+                                       properties) &&
+            !readProperty<char>(reader, value_type, name, mesh_item_type,
+                                n_components, n_values, properties))
+        {
+            ERR("readBinaryMesh(): Could not read property '%s' of '%s'.",
+                name.c_str(), file_name.c_str());
+            delete mesh;
+            return nullptr;
+        }
+    }
+
+    return mesh;
+}
+
+bool writeBinaryMesh(MeshLib::Mesh const& mesh, std::string const& file_name)
+{
+    std::ofstream os(file_name, std::ios::binary);
+    if (!os)
+    {
+        ERR("writeBinaryMesh(): Could not open file '%s' for writing.",
+            file_name.c_str());
+        return false;
+    }
+
+    auto const& nodes = mesh.getNodes();
+    auto const& elements = mesh.getElements();
+    auto const& properties = mesh.getProperties();
+
+    // collect the properties of supported types
+    std::vector<std::string> property_names;
+    for (auto const& name : properties.getPropertyVectorNames())
+    {
+        if (properties.existsPropertyVector<double>(name) ||
+            properties.existsPropertyVector<float>(name) ||
+            properties.existsPropertyVector<int>(name) ||
+            properties.existsPropertyVector<unsigned>(name) ||
+            properties.existsPropertyVector<std::size_t>(name) ||
+            properties.existsPropertyVector<char>(name))
+        {
+            property_names.push_back(name);
+        }
+        else
+        {
+            WARN(
+                "writeBinaryMesh(): Property '%s' has an unsupported data "
+                "type and is not written.",
+                name.c_str());
+        }
+    }
+
+    std::vector<std::uint8_t> cell_types;
+    std::vector<std::uint64_t> offsets;
+    std::vector<std::uint64_t> connectivity;
+    cell_types.reserve(elements.size());
+    offsets.reserve(elements.size() + 1);
+    offsets.push_back(0);
+    for (auto const* element : elements)
+    {
+        cell_types.push_back(static_cast<std::uint8_t>(element->getCellType()));
+        for (unsigned k = 0; k < element->getNumberOfNodes(); ++k)
+        {
+            connectivity.push_back(element->getNodeIndex(k));
+        }
+        offsets.push_back(connectivity.size());
+    }
+
+    writeBytes(os, magic, sizeof(magic));
+    writeUInt64(os, byte_order_mark);
+    writeUInt64(os, format_version);
+    writeUInt64(os, nodes.size());
+    writeUInt64(os, elements.size());
+    writeUInt64(os, connectivity.size());
+    writeUInt64(os, property_names.size());
+
+    std::vector<double> coords;
+    coords.reserve(3 * nodes.size());
+    for (auto const* node : nodes)
+    {
+        coords.insert(coords.end(), node->getCoords(), node->getCoords() + 3);
+    }
+    writeBytes(os, coords.data(), coords.size() * sizeof(double));
+    writeBytes(os, cell_types.data(), cell_types.size());
+    writeBytes(os, offsets.data(), offsets.size() * sizeof(std::uint64_t));
+    writeBytes(os, connectivity.data(),
+               connectivity.size() * sizeof(std::uint64_t));
+
+    for (auto const& name : property_names)
+    {
+        // exactly one of the calls succeeds
+        writeProperty<double>(os, properties, name) ||
+            writeProperty<float>(os, properties, name) ||
+            writeProperty<int>(os, properties, name) ||
+            writeProperty<unsigned>(os, properties, name) ||
+            writeProperty<std::size_t>(os, properties, name) ||
+            writeProperty<char>(os, properties, name);
+    }
+
+    if (!os)
+    {
+        ERR("writeBinaryMesh(): Error while writing file '%s'.",
+            file_name.c_str());
+        return false;
+    }
+    return true;
+}
+
+}  // namespace IO
+}  // namespace MeshLib
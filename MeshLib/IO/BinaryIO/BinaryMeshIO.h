@@ -0,0 +1,51 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+
+namespace MeshLib
+{
+class Mesh;
+
+namespace IO
+{
+/**
+ * Native binary mesh format (file extension \c bmsh).
+ *
+ * The file stores the raw arrays of a mesh, all sections are aligned to 8
+ * bytes and use the byte order of the machine that wrote the file:
+ *  - header: magic string "OGS-BMSH", byte order mark, format version, number
+ *    of nodes, number of elements, length of the connectivity array, number of
+ *    properties (all as 64 bit unsigned integers),
+ *  - node coordinates (3 doubles per node),
+ *  - element cell types (MeshLib::CellType, one byte per element),
+ *  - element offsets into the connectivity array (n_elements + 1 values),
+ *  - connectivity (node ids),
+ *  - properties: name, MeshItemType, value type, number of components, number
+ *    of values and the values.
+ *
+ * Property vectors of type double, float, int, unsigned, std::size_t and char
+ * are supported.
+ *
+ * The reader maps the file into memory, hence the nodes, elements and property
+ * vectors are created directly from the file contents without intermediate
+ * representations.
+ */
+
+/// Reads a mesh stored in the binary format. The mesh name is the base name of
+/// the file. Returns nullptr on error.
+MeshLib::Mesh* readBinaryMesh(std::string const& file_name);
+
+/// Writes the mesh in the binary format. Returns true on success.
+bool writeBinaryMesh(MeshLib::Mesh const& mesh, std::string const& file_name);
+
+}  // namespace IO
+}  // namespace MeshLib
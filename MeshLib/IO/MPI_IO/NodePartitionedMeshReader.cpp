@@ -15,6 +15,12 @@
 
 #include "NodePartitionedMeshReader.h"
 
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <sstream>
+
 #include <logog/include/logog.hpp>
 
 #ifdef USE_PETSC
@@ -102,40 +108,94 @@ MeshLib::NodePartitionedMesh* NodePartitionedMeshReader::read(
     return mesh;
 }
 
-template <typename DATA>
-bool
-NodePartitionedMeshReader::readBinaryDataFromFile(std::string const& filename,
-    MPI_Offset offset, MPI_Datatype type, DATA& data) const
+bool NodePartitionedMeshReader::openFileCollectively(
+    std::string const& filename, MPI_File& file) const
 {
-    // Check container size
-    if (!is_safely_convertable<std::size_t, int>(data.size()))
-    {
-        ERR("The container size is too large for MPI_File_read() call.");
-        return false;
-    }
-
-    // Open file
-    MPI_File file;
+    // Let the MPI-IO layer aggregate the reads of all processes instead of
+    // each process accessing the file system on its own.
+    MPI_Info info;
+    MPI_Info_create(&info);
+    char cb_read_key[] = "romio_cb_read";
+    char cb_read_value[] = "enable";
+    MPI_Info_set(info, cb_read_key, cb_read_value);
+    char cb_key[] = "collective_buffering";
+    char cb_value[] = "true";
+    MPI_Info_set(info, cb_key, cb_value);
 
     char* filename_char = const_cast<char*>(filename.data());
-    int const file_status = MPI_File_open(_mpi_comm, filename_char,
-            MPI_MODE_RDONLY, MPI_INFO_NULL, &file);
+    int const file_status =
+        MPI_File_open(_mpi_comm, filename_char, MPI_MODE_RDONLY, info, &file);
+    MPI_Info_free(&info);
 
     if(file_status != 0)
     {
         ERR("Error opening file %s. MPI error code %d", filename.c_str(), file_status);
         return false;
     }
+    return true;
+}
 
-    // Read data
+bool NodePartitionedMeshReader::readDataCollectively(
+    MPI_File file, MPI_Offset const offset, MPI_Datatype const type,
+    void* const data, std::size_t const count) const
+{
     char file_mode[] = "native";
     MPI_File_set_view(file, offset, type, type, file_mode, MPI_INFO_NULL);
-    // The static cast is checked above.
-    MPI_File_read(file, data.data(), static_cast<int>(data.size()), type,
-        MPI_STATUS_IGNORE);
+
+    MPI_Aint lower_bound;
+    MPI_Aint extent;
+    MPI_Type_get_extent(type, &lower_bound, &extent);
+
+    // MPI_File_read_all() takes the number of values as int, therefore large
+    // containers are read in chunks. All processes must take part in the same
+    // number of collective calls; processes with less data read zero values.
+    std::size_t const max_chunk_size = std::numeric_limits<int>::max();
+    unsigned long number_of_chunks =
+        (count + max_chunk_size - 1) / max_chunk_size;
+    MPI_Allreduce(MPI_IN_PLACE, &number_of_chunks, 1, MPI_UNSIGNED_LONG,
+                  MPI_MAX, _mpi_comm);
+
+    int read_ok = 1;
+    auto* position = static_cast<char*>(data);
+    std::size_t remaining = count;
+    for (unsigned long chunk = 0; chunk < number_of_chunks; ++chunk)
+    {
+        // The static cast is safe because of the chunk size limit.
+        int const chunk_size =
+            static_cast<int>(std::min(remaining, max_chunk_size));
+        MPI_Status status;
+        int read_count = 0;
+        if (MPI_File_read_all(file, position, chunk_size, type, &status) !=
+                MPI_SUCCESS ||
+            MPI_Get_count(&status, type, &read_count) != MPI_SUCCESS ||
+            read_count != chunk_size)
+        {
+            read_ok = 0;
+        }
+        position += static_cast<std::size_t>(chunk_size) * extent;
+        remaining -= chunk_size;
+    }
+
+    MPI_Allreduce(MPI_IN_PLACE, &read_ok, 1, MPI_INT, MPI_MIN, _mpi_comm);
+    return read_ok != 0;
+}
+
+template <typename DATA>
+bool
+NodePartitionedMeshReader::readBinaryDataFromFile(std::string const& filename,
+    MPI_Offset offset, MPI_Datatype type, DATA& data) const
+{
+    MPI_File file;
+    if (!openFileCollectively(filename, file))
+        return false;
+
+    bool const read_ok =
+        readDataCollectively(file, offset, type, data.data(), data.size());
     MPI_File_close(&file);
 
-    return true;
+    if (!read_ok)
+        ERR("Error reading file %s.", filename.c_str());
+    return read_ok;
 }
 
 MeshLib::NodePartitionedMesh* NodePartitionedMeshReader::readBinary(
@@ -214,14 +274,36 @@ void NodePartitionedMeshReader::readPropertiesBinary(
     const std::string fname_cfg = file_name_base + "_partitioned_" + item_type +
                                   "_properties_cfg" +
                                   std::to_string(_mpi_comm_size) + ".bin";
-    std::ifstream is(fname_cfg.c_str(), std::ios::binary | std::ios::in);
-    if (!is)
+    // The meta data is read by the first process only and is broadcast to the
+    // others, which avoids that all processes access the file concurrently.
+    std::string cfg_data;
+    unsigned long cfg_size = 0;
+    int cfg_read_ok = 0;
+    if (_mpi_rank == 0)
+    {
+        std::ifstream is(fname_cfg.c_str(), std::ios::binary | std::ios::in);
+        if (is)
+        {
+            cfg_data.assign(std::istreambuf_iterator<char>(is),
+                            std::istreambuf_iterator<char>());
+            cfg_size = cfg_data.size();
+            cfg_read_ok = is_safely_convertable<unsigned long, int>(cfg_size);
+        }
+    }
+    MPI_Bcast(&cfg_read_ok, 1, MPI_INT, 0, _mpi_comm);
+    if (!cfg_read_ok)
     {
         WARN("Could not open file '%s'.\n"
              "\tYou can ignore this warning if the mesh does not contain %s-"
              "wise property data.", fname_cfg.c_str(), item_type.data());
         return;
     }
+    MPI_Bcast(&cfg_size, 1, MPI_UNSIGNED_LONG, 0, _mpi_comm);
+    cfg_data.resize(cfg_size);
+    MPI_Bcast(&cfg_data[0], static_cast<int>(cfg_size), MPI_CHAR, 0,
+              _mpi_comm);
+    std::istringstream is(cfg_data);
+
     std::size_t number_of_properties = 0;
     is.read(reinterpret_cast<char*>(&number_of_properties), sizeof(std::size_t));
     std::vector<boost::optional<MeshLib::IO::PropertyVectorMetaData>> vec_pvmd(
@@ -253,7 +335,7 @@ void NodePartitionedMeshReader::readPropertiesBinary(
         MeshLib::IO::readPropertyVectorPartitionMetaData(is));
     bool pvpmd_read_ok = static_cast<bool>(pvpmd);
     bool all_pvpmd_read_ok;
-    MPI_Allreduce(&pvpmd_read_ok, &all_pvpmd_read_ok, 1, MPI_C_BOOL, MPI_LOR,
+    MPI_Allreduce(&pvpmd_read_ok, &all_pvpmd_read_ok, 1, MPI_C_BOOL, MPI_LAND,
                   _mpi_comm);
     if (!all_pvpmd_read_ok)
     {
@@ -264,20 +346,21 @@ void NodePartitionedMeshReader::readPropertiesBinary(
     }
     DBUG("[%d] offset in the PropertyVector: %d", _mpi_rank, pvpmd->offset);
     DBUG("[%d] %d tuples in partition.", _mpi_rank, pvpmd->number_of_tuples);
-    is.close();
 
     const std::string fname_val = file_name_base + "_partitioned_" + item_type +
                                   "_properties_val" +
                                   std::to_string(_mpi_comm_size) + ".bin";
-    is.open(fname_val.c_str(), std::ios::binary | std::ios::in);
-    if (!is)
+    MPI_File file;
+    if (!openFileCollectively(fname_val, file))
     {
-        ERR("Could not open file '%s'\n."
-            "\tYou can ignore this warning if the mesh does not contain %s-"
-             "wise property data.", fname_val.c_str(), item_type.data());
+        OGS_FATAL(
+            "Error in NodePartitionedMeshReader::readPropertiesBinary: "
+            "Could not open file '%s' containing the %s-wise property data.",
+            fname_val.c_str(), item_type.data());
     }
 
-    readDomainSpecificPartOfPropertyVectors(vec_pvmd, *pvpmd, t, is, p);
+    readDomainSpecificPartOfPropertyVectors(vec_pvmd, *pvpmd, t, file, p);
+    MPI_File_close(&file);
 }
 
 void NodePartitionedMeshReader::readDomainSpecificPartOfPropertyVectors(
@@ -285,7 +368,7 @@ void NodePartitionedMeshReader::readDomainSpecificPartOfPropertyVectors(
         vec_pvmd,
     MeshLib::IO::PropertyVectorPartitionMetaData const& pvpmd,
     MeshLib::MeshItemType t,
-    std::istream& is,
+    MPI_File file,
     MeshLib::Properties& p) const
 {
     unsigned long global_offset = 0;
@@ -301,10 +384,10 @@ void NodePartitionedMeshReader::readDomainSpecificPartOfPropertyVectors(
             if (vec_pvmd[i]->is_data_type_signed)
             {
                 if (vec_pvmd[i]->data_type_size_in_bytes == sizeof(int))
-                    createPropertyVectorPart<int>(is, *vec_pvmd[i], pvpmd, t,
+                    createPropertyVectorPart<int>(file, *vec_pvmd[i], pvpmd, t,
                                                   global_offset, p);
                 if (vec_pvmd[i]->data_type_size_in_bytes == sizeof(long))
-                    createPropertyVectorPart<long>(is, *vec_pvmd[i], pvpmd, t,
+                    createPropertyVectorPart<long>(file, *vec_pvmd[i], pvpmd, t,
                                                    global_offset, p);
             }
             else
@@ -312,20 +395,20 @@ void NodePartitionedMeshReader::readDomainSpecificPartOfPropertyVectors(
                 if (vec_pvmd[i]->data_type_size_in_bytes ==
                     sizeof(unsigned int))
                     createPropertyVectorPart<unsigned int>(
-                        is, *vec_pvmd[i], pvpmd, t, global_offset, p);
+                        file, *vec_pvmd[i], pvpmd, t, global_offset, p);
                 if (vec_pvmd[i]->data_type_size_in_bytes ==
                     sizeof(unsigned long))
                     createPropertyVectorPart<unsigned long>(
-                        is, *vec_pvmd[i], pvpmd, t, global_offset, p);
+                        file, *vec_pvmd[i], pvpmd, t, global_offset, p);
             }
         }
         else
         {
             if (vec_pvmd[i]->data_type_size_in_bytes == sizeof(float))
-                createPropertyVectorPart<float>(is, *vec_pvmd[i], pvpmd, t,
+                createPropertyVectorPart<float>(file, *vec_pvmd[i], pvpmd, t,
                                                 global_offset, p);
             if (vec_pvmd[i]->data_type_size_in_bytes == sizeof(double))
-                createPropertyVectorPart<double>(is, *vec_pvmd[i], pvpmd, t,
+                createPropertyVectorPart<double>(file, *vec_pvmd[i], pvpmd, t,
                                                  global_offset, p);
         }
         global_offset += vec_pvmd[i]->data_type_size_in_bytes *
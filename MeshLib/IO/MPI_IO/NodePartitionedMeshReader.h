@@ -120,13 +120,42 @@ private:
         MeshLib::Properties const& properties) const;
 
     /*!
-        \brief Parallel reading of a binary file via MPI_File_read, and it is called by readBinary
-               to read files of mesh data head, nodes, non-ghost elements and ghost elements, respectively.
+        \brief Opens a file for collective reading by all processes of the
+               communicator. The MPI-IO layer is asked to aggregate the reads
+               of the processes (collective buffering).
+        \param filename File name.
+        \param file     The opened file handle.
+        \return         True on success and false otherwise.
+     */
+    bool openFileCollectively(std::string const& filename,
+                              MPI_File& file) const;
+
+    /*!
+        \brief Collective reading of \c count values of the given type from an
+               opened file via MPI_File_read_all. All processes of the
+               communicator have to call this function.
+        \note Containers with more values than MPI_File_read_all() supports
+              in a single call (maximum of the \c int type) are read in chunks.
+        \param file     File opened with openFileCollectively().
+        \param offset   Displacement of the data in bytes, see
+                        MPI_File_set_view() documentation.
+        \param type     Type of data.
+        \param data     Memory for \c count values of \c type.
+        \param count    Number of values to be read by this process.
+        \return         True if all processes read their data and false
+                        otherwise.
+     */
+    bool readDataCollectively(MPI_File file, MPI_Offset offset,
+                              MPI_Datatype type, void* data,
+                              std::size_t count) const;
+
+    /*!
+        \brief Collective parallel reading of a binary file via
+               MPI_File_read_all, and it is called by readBinary to read files
+               of mesh data head, nodes, non-ghost elements and ghost elements,
+               respectively.
         \note           In case of failure during opening of the file, an
                         error message is printed.
-        \note If the number of elements in container is larger than
-              MPI_file_read() supports (maximum of current \c int type), an
-              error is printed.
         \param filename File name containing data.
         \param offset   Displacement of the data accessible from the view.
                         see MPI_File_set_view() documentation.
@@ -177,12 +206,12 @@ private:
             vec_pvmd,
         MeshLib::IO::PropertyVectorPartitionMetaData const& pvpmd,
         MeshLib::MeshItemType t,
-        std::istream& is,
+        MPI_File file,
         MeshLib::Properties& p) const;
 
     template <typename T>
     void createPropertyVectorPart(
-        std::istream& is, MeshLib::IO::PropertyVectorMetaData const& pvmd,
+        MPI_File file, MeshLib::IO::PropertyVectorMetaData const& pvmd,
         MeshLib::IO::PropertyVectorPartitionMetaData const& pvpmd,
         MeshLib::MeshItemType t, unsigned long global_offset,
         MeshLib::Properties& p) const
@@ -190,14 +219,14 @@ private:
         MeshLib::PropertyVector<T>* pv = p.createNewPropertyVector<T>(
             pvmd.property_name, t, pvmd.number_of_components);
         pv->resize(pvpmd.number_of_tuples * pvmd.number_of_components);
-        // jump to the place for reading the specific part of the
-        // PropertyVector
-        is.seekg(global_offset + pvpmd.offset * sizeof(T));
+        // the place for reading the specific part of the PropertyVector
+        MPI_Offset const offset = global_offset + pvpmd.offset * sizeof(T);
         // read the values
         unsigned long const number_of_bytes = pvmd.data_type_size_in_bytes *
                                               pvpmd.number_of_tuples *
                                               pvmd.number_of_components;
-        if (!is.read(reinterpret_cast<char*>(pv->data()), number_of_bytes))
+        if (!readDataCollectively(file, offset, MPI_BYTE, pv->data(),
+                                  number_of_bytes))
             OGS_FATAL(
                 "Error in NodePartitionedMeshReader::readPropertiesBinary: "
                 "Could not read part %d of the PropertyVector.",
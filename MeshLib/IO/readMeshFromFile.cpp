@@ -30,6 +30,7 @@
 
 #include "MeshLib/Mesh.h"
 
+#include "MeshLib/IO/BinaryIO/BinaryMeshIO.h"
 #include "MeshLib/IO/Legacy/MeshIO.h"
 #include "MeshLib/IO/VtkIO/VtuInterface.h"
 
@@ -80,6 +81,11 @@ MeshLib::Mesh* readMeshFromFileSerial(const std::string &file_name)
         return MeshLib::IO::VtuInterface::readVTUFile(file_name);
     }
 
+    if (BaseLib::hasFileExtension("bmsh", file_name))
+    {
+        return MeshLib::IO::readBinaryMesh(file_name);
+    }
+
     ERR("readMeshFromFile(): Unknown mesh file format in file %s.", file_name.c_str());
     return nullptr;
 }
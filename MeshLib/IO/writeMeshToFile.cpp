@@ -15,6 +15,7 @@
 
 #include "MeshLib/Mesh.h"
 
+#include "MeshLib/IO/BinaryIO/BinaryMeshIO.h"
 #include "MeshLib/IO/Legacy/MeshIO.h"
 #include "MeshLib/IO/VtkIO/VtuInterface.h"
 
@@ -43,6 +44,16 @@ int writeMeshToFile(const MeshLib::Mesh &mesh, const std::string &file_name)
         }
         return 0;
     }
+    if (BaseLib::hasFileExtension("bmsh", file_name))
+    {
+        if (!MeshLib::IO::writeBinaryMesh(mesh, file_name))
+        {
+            ERR("writeMeshToFile(): Could not write mesh to '%s'.",
+                file_name.c_str());
+            return -1;
+        }
+        return 0;
+    }
 
     ERR("writeMeshToFile(): Unknown mesh file format in file %s.", file_name.c_str());
     return -1;
@@ -12,13 +12,16 @@
  *
  */
 
+#include <algorithm>
+#include <utility>
 #include <vector>
-#include <fstream>
 
 #include "Mesh2MeshPropertyInterpolation.h"
 
 #include <logog/include/logog.hpp>
 
+#include "BaseLib/Error.h"
+
 #include "GeoLib/AABB.h"
 #include "GeoLib/Grid.h"
 
@@ -31,9 +34,20 @@ namespace MeshLib {
 
 Mesh2MeshPropertyInterpolation::Mesh2MeshPropertyInterpolation(
     Mesh const& src_mesh, std::string const& property_name)
-    : _src_mesh(src_mesh), _property_name(property_name)
+    : Mesh2MeshPropertyInterpolation(src_mesh,
+                                     std::vector<std::string>{property_name})
+{}
+
+Mesh2MeshPropertyInterpolation::Mesh2MeshPropertyInterpolation(
+    Mesh const& src_mesh, std::vector<std::string> property_names)
+    : _src_mesh(src_mesh),
+      _property_names(std::move(property_names)),
+      _src_grid(std::make_unique<GeoLib::Grid<MeshLib::Node>>(
+          src_mesh.getNodes().begin(), src_mesh.getNodes().end(), 64))
 {}
 
+Mesh2MeshPropertyInterpolation::~Mesh2MeshPropertyInterpolation() = default;
+
 bool Mesh2MeshPropertyInterpolation::setPropertiesForMesh(Mesh& dest_mesh) const
 {
     if (_src_mesh.getDimension() != dest_mesh.getDimension()) {
@@ -44,132 +58,173 @@ bool Mesh2MeshPropertyInterpolation::setPropertiesForMesh(Mesh& dest_mesh) const
         return false;
     }
 
-    if (_src_mesh.getDimension() != 2) {
+    if (_src_mesh.getDimension() != 2 && _src_mesh.getDimension() != 3)
+    {
         WARN(
             "MeshLib::Mesh2MeshPropertyInterpolation::setPropertiesForMesh() "
-            "implemented only for 2D case at the moment.");
+            "implemented only for 2D and 3D meshes at the moment.");
         return false;
     }
 
-    MeshLib::PropertyVector<double>* dest_properties;
-    if (dest_mesh.getProperties().existsPropertyVector<double>(_property_name))
+    std::vector<MeshLib::PropertyVector<double>*> dest_properties;
+    for (auto const& property_name : _property_names)
     {
-        dest_properties =
-            dest_mesh.getProperties().getPropertyVector<double>(_property_name);
-    }
-    else
-    {
-        INFO("Create new PropertyVector '%s' of type double.",
-             _property_name.c_str());
-        dest_properties =
-            dest_mesh.getProperties().createNewPropertyVector<double>(
-                _property_name, MeshItemType::Cell, 1);
-        if (!dest_properties)
+        if (!_src_mesh.getProperties().existsPropertyVector<double>(
+                property_name))
         {
-            WARN(
-                "Could not get or create a PropertyVector of type double"
-                " using the given name '%s'.",
-                _property_name.c_str());
+            WARN("Did not find PropertyVector<double> '%s'.",
+                 property_name.c_str());
             return false;
         }
-    }
-    if (dest_properties->size() != dest_mesh.getNumberOfElements())
-    {
-        dest_properties->resize(dest_mesh.getNumberOfElements());
+
+        MeshLib::PropertyVector<double>* dest_property;
+        if (dest_mesh.getProperties().existsPropertyVector<double>(
+                property_name))
+        {
+            dest_property = dest_mesh.getProperties().getPropertyVector<double>(
+                property_name);
+        }
+        else
+        {
+            INFO("Create new PropertyVector '%s' of type double.",
+                 property_name.c_str());
+            dest_property =
+                dest_mesh.getProperties().createNewPropertyVector<double>(
+                    property_name, MeshItemType::Cell, 1);
+            if (!dest_property)
+            {
+                WARN(
+                    "Could not get or create a PropertyVector of type double"
+                    " using the given name '%s'.",
+                    property_name.c_str());
+                return false;
+            }
+        }
+        if (dest_property->size() != dest_mesh.getNumberOfElements())
+        {
+            dest_property->resize(dest_mesh.getNumberOfElements());
+        }
+        dest_properties.push_back(dest_property);
     }
 
-    interpolatePropertiesForMesh(dest_mesh, *dest_properties);
+    interpolatePropertiesForMesh(dest_mesh, dest_properties);
 
     return true;
 }
 
 void Mesh2MeshPropertyInterpolation::interpolatePropertiesForMesh(
-    Mesh& dest_mesh, MeshLib::PropertyVector<double>& dest_properties) const
+    Mesh const& dest_mesh,
+    std::vector<MeshLib::PropertyVector<double>*> const& dest_properties) const
 {
-    std::vector<double> interpolated_src_node_properties(
-        _src_mesh.getNumberOfNodes());
-    interpolateElementPropertiesToNodeProperties(
-        interpolated_src_node_properties);
+    std::size_t const n_properties(_property_names.size());
+    std::vector<std::vector<double>> interpolated_src_node_properties(
+        n_properties, std::vector<double>(_src_mesh.getNumberOfNodes()));
+    for (std::size_t p(0); p < n_properties; p++)
+    {
+        interpolateElementPropertiesToNodeProperties(
+            *_src_mesh.getProperties().getPropertyVector<double>(
+                _property_names[p]),
+            interpolated_src_node_properties[p]);
+    }
 
     // idea: looping over the destination elements and calculate properties
     // from interpolated_src_node_properties to accelerate the (source) point
-    // search construct a grid
-    std::vector<MeshLib::Node*> const& src_nodes(_src_mesh.getNodes());
-    GeoLib::Grid<MeshLib::Node> src_grid(src_nodes.begin(), src_nodes.end(),
-                                         64);
-
+    // search the grid constructed in the constructor is used
+    unsigned const dim(dest_mesh.getDimension());
     auto const& dest_elements(dest_mesh.getElements());
-    const std::size_t n_dest_elements(dest_elements.size());
-    for (std::size_t k(0); k < n_dest_elements; k++)
+    auto const n_dest_elements = static_cast<long long>(dest_elements.size());
+    // smallest id of an element without source nodes
+    long long first_failed_element(n_dest_elements);
+
+#pragma omp parallel
     {
-        MeshLib::Element& dest_element(*dest_elements[k]);
-        if (dest_element.getGeomType() == MeshElemType::LINE)
+        std::vector<std::vector<MeshLib::Node*> const*> nodes;
+        std::vector<double> average_values(n_properties);
+
+#pragma omp for
+        for (long long k = 0; k < n_dest_elements; k++)
         {
-            continue;
-        }
+            MeshLib::Element const& dest_element(*dest_elements[k]);
+            if (dest_element.getDimension() < dim)
+            {
+                continue;
+            }
 
-        // compute axis aligned bounding box around the current element
-        const GeoLib::AABB elem_aabb(
-            dest_element.getNodes(),
-            dest_element.getNodes() + dest_element.getNumberOfBaseNodes());
+            // compute axis aligned bounding box around the current element
+            const GeoLib::AABB elem_aabb(
+                dest_element.getNodes(),
+                dest_element.getNodes() + dest_element.getNumberOfBaseNodes());
 
-        // request "interesting" nodes from grid
-        std::vector<std::vector<MeshLib::Node*> const*> nodes;
-        src_grid.getPntVecsOfGridCellsIntersectingCuboid(
-            elem_aabb.getMinPoint(), elem_aabb.getMaxPoint(), nodes);
+            // request "interesting" nodes from grid
+            nodes.clear();
+            _src_grid->getPntVecsOfGridCellsIntersectingCuboid(
+                elem_aabb.getMinPoint(), elem_aabb.getMaxPoint(), nodes);
 
-        std::size_t cnt(0);
-        double average_value(0.0);
+            std::size_t cnt(0);
+            std::fill(average_values.begin(), average_values.end(), 0.0);
 
-        for (auto const* nodes_vec : nodes)
-        {
-            for (auto const* node : *nodes_vec)
+            for (auto const* nodes_vec : nodes)
             {
-                if (elem_aabb.containsPointXY(*node) &&
-                    MeshLib::isPointInElementXY(*node, dest_element))
+                for (auto const* node : *nodes_vec)
                 {
-                    average_value +=
-                        interpolated_src_node_properties[node->getID()];
+                    bool const is_inside =
+                        dim == 2
+                            ? elem_aabb.containsPointXY(*node) &&
+                                  MeshLib::isPointInElementXY(*node,
+                                                              dest_element)
+                            : elem_aabb.containsPoint(*node, 0.0) &&
+                                  dest_element.isPntInElement(*node);
+                    if (!is_inside)
+                    {
+                        continue;
+                    }
+                    for (std::size_t p(0); p < n_properties; p++)
+                    {
+                        average_values[p] +=
+                            interpolated_src_node_properties[p][node->getID()];
+                    }
                     cnt++;
                 }
             }
-        }
 
-        if (cnt == 0)
-        {
-            OGS_FATAL(
-                "Mesh2MeshInterpolation: Could not find values in source mesh "
-                "for the element %d.",
-                k);
+            if (cnt == 0)
+            {
+#pragma omp critical
+                first_failed_element = std::min(first_failed_element, k);
+                continue;
+            }
+            for (std::size_t p(0); p < n_properties; p++)
+            {
+                (*dest_properties[p])[k] = average_values[p] / cnt;
+            }
         }
-        dest_properties[k] = average_value / cnt;
     }
-}
 
-void Mesh2MeshPropertyInterpolation::interpolateElementPropertiesToNodeProperties(
-    std::vector<double> &interpolated_properties) const
-{
-    // fetch the source of property values
-    if (!_src_mesh.getProperties().existsPropertyVector<double>(_property_name))
+    if (first_failed_element < n_dest_elements)
     {
-        WARN("Did not find PropertyVector<double> '%s'.",
-             _property_name.c_str());
-        return;
+        OGS_FATAL(
+            "Mesh2MeshInterpolation: Could not find values in source mesh "
+            "for the element %lld.",
+            first_failed_element);
     }
-    auto const* elem_props =
-        _src_mesh.getProperties().getPropertyVector<double>(_property_name);
+}
 
+void Mesh2MeshPropertyInterpolation::interpolateElementPropertiesToNodeProperties(
+    MeshLib::PropertyVector<double> const& elem_props,
+    std::vector<double>& interpolated_properties) const
+{
     std::vector<MeshLib::Node*> const& src_nodes(_src_mesh.getNodes());
-    const std::size_t n_src_nodes(src_nodes.size());
-    for (std::size_t k(0); k < n_src_nodes; k++)
+    auto const n_src_nodes = static_cast<long long>(src_nodes.size());
+#pragma omp parallel for
+    for (long long k = 0; k < n_src_nodes; k++)
     {
         const std::size_t n_con_elems(src_nodes[k]->getNumberOfElements());
         interpolated_properties[k] =
-            (*elem_props)[(src_nodes[k]->getElement(0))->getID()];
+            elem_props[(src_nodes[k]->getElement(0))->getID()];
         for (std::size_t j(1); j < n_con_elems; j++)
         {
             interpolated_properties[k] +=
-                (*elem_props)[(src_nodes[k]->getElement(j))->getID()];
+                elem_props[(src_nodes[k]->getElement(j))->getID()];
         }
         interpolated_properties[k] /= n_con_elems;
     }
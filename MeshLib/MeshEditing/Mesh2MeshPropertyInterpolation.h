@@ -14,17 +14,33 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "MeshLib/PropertyVector.h"
 
+namespace GeoLib
+{
+template <typename POINT>
+class Grid;
+}
+
 namespace MeshLib {
 
 class Mesh;
+class Node;
 
 /**
  * Class Mesh2MeshPropertyInterpolation transfers properties of
  * mesh elements of a (source) mesh to mesh elements of another
  * (destination) mesh deploying weighted interpolation. The two
- * meshes must have the same dimension.
+ * meshes must have the same dimension, 2d and 3d meshes are supported.
+ *
+ * The search structure for the source mesh nodes is built once in the
+ * constructor and reused for every call of setPropertiesForMesh(). All
+ * properties are transferred in a single (parallel) pass over the destination
+ * elements.
  */
 class Mesh2MeshPropertyInterpolation final
 {
@@ -39,7 +55,18 @@ public:
                                    std::string const& property_name);
 
     /**
-     * Calculates entries for the property vector and sets appropriate indices
+     * Constructor taking the source mesh and the names of several cell
+     * properties of type double that are transferred together.
+     * @param src_mesh the mesh the given property information is assigned to.
+     * @param property_names names of PropertyVectors in the \c source_mesh
+     */
+    Mesh2MeshPropertyInterpolation(Mesh const& src_mesh,
+                                   std::vector<std::string> property_names);
+
+    ~Mesh2MeshPropertyInterpolation();
+
+    /**
+     * Calculates entries for the property vectors and sets appropriate indices
      * in the mesh elements.
      * @param mesh the mesh the property information will be calculated and set
      * via weighted interpolation
@@ -50,24 +77,29 @@ public:
 private:
     /**
      * @param dest_mesh
-     * @param dest_properties
+     * @param dest_properties one property vector per property name
      */
     void interpolatePropertiesForMesh(
-        Mesh& dest_mesh,
-        MeshLib::PropertyVector<double>& dest_properties) const;
+        Mesh const& dest_mesh,
+        std::vector<MeshLib::PropertyVector<double>*> const& dest_properties)
+        const;
 
     /**
      * Method interpolates the element wise given properties to the nodes of the
      * element
+     * @param elem_props the source mesh element property
      * @param interpolated_properties the vector must have the same number of
      * entries as the source mesh has number of nodes, the content of the
      * particular entries will be overwritten
      */
     void interpolateElementPropertiesToNodeProperties(
+        MeshLib::PropertyVector<double> const& elem_props,
         std::vector<double>& interpolated_properties) const;
 
     Mesh const& _src_mesh;
-    std::string const& _property_name;
+    std::vector<std::string> const _property_names;
+    /// Search structure for the source mesh nodes.
+    std::unique_ptr<GeoLib::Grid<MeshLib::Node>> const _src_grid;
 };
 
 } // end namespace MeshLib
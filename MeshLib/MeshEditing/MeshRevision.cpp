@@ -28,6 +28,76 @@
 
 namespace MeshLib {
 
+namespace
+{
+/// Revises all elements in parallel by calling
+/// revise(k, revised_elements, n_material_values) for each element k. The
+/// function appends the revised elements of element k and sets the number of
+/// material values to be added for it; it returns false if the element could
+/// not be revised.
+/// The elements are processed in blocks to bound the memory needed for the
+/// intermediate results. The revised elements and the material values are
+/// appended in the order of the original elements.
+/// \return false if any element could not be revised. In that case the
+/// already created new elements are stored in \c new_elements.
+template <typename ReviseElement>
+bool reviseElements(std::vector<MeshLib::Element*> const& elements,
+                    ReviseElement const& revise,
+                    std::vector<MeshLib::Element*>& new_elements,
+                    PropertyVector<int> const* const material_vec,
+                    PropertyVector<int>* const new_material_vec)
+{
+    std::size_t const block_size = 1 << 16;
+    std::size_t const n_elements = elements.size();
+
+    std::vector<std::vector<MeshLib::Element*>> revised_elements(
+        std::min(block_size, n_elements));
+    std::vector<std::size_t> n_material_values(revised_elements.size());
+    std::vector<char> success(revised_elements.size());
+
+    for (std::size_t block_begin = 0; block_begin < n_elements;
+         block_begin += block_size)
+    {
+        auto const n =
+            static_cast<long long>(std::min(block_size, n_elements - block_begin));
+#pragma omp parallel for
+        for (long long i = 0; i < n; ++i)
+        {
+            revised_elements[i].clear();
+            n_material_values[i] = 0;
+            success[i] = revise(block_begin + i, revised_elements[i],
+                                n_material_values[i]);
+        }
+
+        for (long long i = 0; i < n; ++i)
+        {
+            new_elements.insert(new_elements.end(),
+                                revised_elements[i].begin(),
+                                revised_elements[i].end());
+            if (!success[i])
+            {
+                ERR("Element %d has unknown element type.", block_begin + i);
+                // hand over the remaining elements of the block for clean up
+                for (long long j = i + 1; j < n; ++j)
+                {
+                    new_elements.insert(new_elements.end(),
+                                        revised_elements[j].begin(),
+                                        revised_elements[j].end());
+                }
+                return false;
+            }
+            if (material_vec)
+            {
+                new_material_vec->insert(new_material_vec->end(),
+                                         n_material_values[i],
+                                         (*material_vec)[block_begin + i]);
+            }
+        }
+    }
+    return true;
+}
+}  // namespace
+
 const std::array<unsigned, 8> MeshRevision::_hex_diametral_nodes = {{ 6, 7, 4, 5, 2, 3, 0, 1 }};
 
 MeshRevision::MeshRevision(MeshLib::Mesh &mesh) :
@@ -83,7 +153,9 @@ MeshLib::Mesh* MeshRevision::simplifyMesh(const std::string &new_mesh_name,
             "MaterialIDs", MeshItemType::Cell, 1);
     }
 
-    for (std::size_t k(0); k<elements.size(); ++k) {
+    auto revise = [&](std::size_t const k,
+                      std::vector<MeshLib::Element*>& revised_elements,
+                      std::size_t& n_material_values) {
         MeshLib::Element const*const elem(elements[k]);
         unsigned n_unique_nodes(this->getNumberOfUniqueNodes(elem));
         if (n_unique_nodes == elem->getNumberOfBaseNodes()
@@ -92,42 +164,27 @@ MeshLib::Mesh* MeshRevision::simplifyMesh(const std::string &new_mesh_name,
             ElementErrorCode e(elem->validate());
             if (e[ElementErrorFlag::NonCoplanar])
             {
-                std::size_t const n_new_elements(
-                    subdivideElement(elem, new_nodes, new_elements));
-                if (n_new_elements == 0)
-                {
-                    ERR("Element %d has unknown element type.", k);
-                    this->resetNodeIDs();
-                    this->cleanUp(new_nodes, new_elements);
-                    return nullptr;
-                }
-                if (material_vec)
-                {
-                    new_material_vec->insert(new_material_vec->end(),
-                                             n_new_elements,
-                                             (*material_vec)[k]);
-                }
-            } else {
-                new_elements.push_back(MeshLib::copyElement(elem, new_nodes));
-                // copy material values
-                if (material_vec)
-                {
-                    new_material_vec->push_back((*material_vec)[k]);
-                }
+                n_material_values =
+                    subdivideElement(elem, new_nodes, revised_elements);
+                return n_material_values != 0;
             }
+            revised_elements.push_back(MeshLib::copyElement(elem, new_nodes));
+            n_material_values = 1;
         }
         else if (n_unique_nodes < elem->getNumberOfBaseNodes() && n_unique_nodes>1) {
-            std::size_t const n_new_elements(reduceElement(
-                elem, n_unique_nodes, new_nodes, new_elements, min_elem_dim)
-            );
-            if (!material_vec)
-            {
-                continue;
-            }
-            new_material_vec->insert(new_material_vec->end(),
-                n_new_elements, (*material_vec)[k]);
+            n_material_values = reduceElement(
+                elem, n_unique_nodes, new_nodes, revised_elements, min_elem_dim);
         } else
             ERR ("Something is wrong, more unique nodes than actual nodes");
+        return true;
+    };
+
+    if (!reviseElements(elements, revise, new_elements, material_vec,
+                        new_material_vec))
+    {
+        this->resetNodeIDs();
+        this->cleanUp(new_nodes, new_elements);
+        return nullptr;
     }
 
     this->resetNodeIDs();
@@ -164,34 +221,27 @@ MeshLib::Mesh* MeshRevision::subdivideMesh(const std::string &new_mesh_name) con
         );
     }
 
-    for (std::size_t k(0); k<elements.size(); ++k) {
+    auto revise = [&](std::size_t const k,
+                      std::vector<MeshLib::Element*>& revised_elements,
+                      std::size_t& n_material_values) {
         MeshLib::Element const*const elem(elements[k]);
         ElementErrorCode error_code(elem->validate());
         if (error_code[ElementErrorFlag::NonCoplanar])
         {
-            std::size_t const n_new_elements(
-                subdivideElement(elem, new_nodes, new_elements));
-            if (n_new_elements == 0)
-            {
-                ERR("Element %d has unknown element type.", k);
-                this->cleanUp(new_nodes, new_elements);
-                return nullptr;
-            }
-            // copy material values
-            if (!material_vec)
-            {
-                continue;
-            }
-            new_material_vec->insert(new_material_vec->end(), n_new_elements,
-                (*material_vec)[k]);
-        } else {
-            new_elements.push_back(MeshLib::copyElement(elem, new_nodes));
-            // copy material values
-            if (material_vec)
-            {
-                new_material_vec->push_back((*material_vec)[k]);
-            }
+            n_material_values =
+                subdivideElement(elem, new_nodes, revised_elements);
+            return n_material_values != 0;
         }
+        revised_elements.push_back(MeshLib::copyElement(elem, new_nodes));
+        n_material_values = 1;
+        return true;
+    };
+
+    if (!reviseElements(elements, revise, new_elements, material_vec,
+                        new_material_vec))
+    {
+        this->cleanUp(new_nodes, new_elements);
+        return nullptr;
     }
 
     if (!new_elements.empty())
@@ -215,6 +265,50 @@ std::vector<std::size_t> MeshRevision::collapseNodeIndices(double eps) const
 
     GeoLib::Grid<MeshLib::Node> const grid(nodes.begin(), nodes.end(), 64);
 
+    // Calls f(test_node) for all nodes closer than eps to the given node in
+    // the order given by the grid.
+    auto forEachCloseNode = [&](MeshLib::Node const& node, auto&& f) {
+        for (auto const* const cell_vector :
+             grid.getPntVecsOfGridCellsIntersectingCube(node, half_eps))
+        {
+            for (MeshLib::Node const* const test_node : *cell_vector)
+            {
+                if (test_node != &node &&
+                    MathLib::sqrDist(node.getCoords(),
+                                     test_node->getCoords()) < sqr_eps)
+                {
+                    f(*test_node);
+                }
+            }
+        }
+    };
+
+    // The expensive search for close nodes is independent for each node and
+    // done in parallel in two passes, first counting and then storing the ids
+    // of the close nodes in a compressed row format.
+    auto const n_nodes = static_cast<long long>(nNodes);
+    std::vector<std::size_t> offsets(nNodes + 1, 0);
+#pragma omp parallel for
+    for (long long k = 0; k < n_nodes; ++k)
+    {
+        std::size_t count = 0;
+        forEachCloseNode(*nodes[k], [&count](MeshLib::Node const&) { ++count; });
+        offsets[k + 1] = count;
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::vector<std::size_t> close_node_ids(offsets.back());
+#pragma omp parallel for
+    for (long long k = 0; k < n_nodes; ++k)
+    {
+        auto position = offsets[k];
+        forEachCloseNode(*nodes[k],
+                         [&](MeshLib::Node const& test_node) {
+                             close_node_ids[position++] = test_node.getID();
+                         });
+    }
+
+    // The collapsing depends on the order of the nodes and is done serially.
     for (std::size_t k = 0; k < nNodes; ++k)
     {
         MeshLib::Node const*const node(nodes[k]);
@@ -222,37 +316,23 @@ std::vector<std::size_t> MeshRevision::collapseNodeIndices(double eps) const
         {
             continue;
         }
-        std::vector<std::vector<MeshLib::Node*> const*> node_vectors(
-            grid.getPntVecsOfGridCellsIntersectingCube(*node, half_eps));
-
-        const std::size_t nVectors(node_vectors.size());
-        for (std::size_t i = 0; i < nVectors; ++i)
+        for (auto i = offsets[k]; i < offsets[k + 1]; ++i)
         {
-            const std::vector<MeshLib::Node*> &cell_vector(*node_vectors[i]);
-            const std::size_t nGridCellNodes(cell_vector.size());
-            for (std::size_t j = 0; j < nGridCellNodes; ++j)
+            std::size_t const test_node_id = close_node_ids[i];
+            // are node indices already identical (i.e. nodes will be collapsed)
+            if (id_map[node->getID()] == id_map[test_node_id])
             {
-                MeshLib::Node const*const test_node(cell_vector[j]);
-                // are node indices already identical (i.e. nodes will be collapsed)
-                if (id_map[node->getID()] == id_map[test_node->getID()])
-                {
-                    continue;
-                }
-
-                // if test_node has already been collapsed to another node x, ignore it
-                // (if the current node would need to be collapsed with x it would already have happened when x was tested)
-                if (test_node->getID() != id_map[test_node->getID()])
-                {
-                    continue;
-                }
+                continue;
+            }
 
-                // calc distance
-                if (MathLib::sqrDist(node->getCoords(),
-                                     test_node->getCoords()) < sqr_eps)
-                {
-                    id_map[test_node->getID()] = node->getID();
-                }
+            // if test_node has already been collapsed to another node x, ignore it
+            // (if the current node would need to be collapsed with x it would already have happened when x was tested)
+            if (test_node_id != id_map[test_node_id])
+            {
+                continue;
             }
+
+            id_map[test_node_id] = node->getID();
         }
     }
     return id_map;
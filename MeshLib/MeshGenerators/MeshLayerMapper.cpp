@@ -54,16 +54,28 @@ MeshLib::Mesh* MeshLayerMapper::createStaticLayers(MeshLib::Mesh const& mesh, st
     }
 
     const std::size_t nNodes = mesh.getNumberOfNodes();
-    // count number of 2d elements in the original mesh
-    const std::size_t nElems (std::count_if(mesh.getElements().begin(), mesh.getElements().end(),
-            [](MeshLib::Element const* elem) { return (elem->getDimension() == 2);}));
-
-    const std::size_t nOrgElems (mesh.getNumberOfElements());
     const std::vector<MeshLib::Node*> &nodes = mesh.getNodes();
     const std::vector<MeshLib::Element*> &elems = mesh.getElements();
+
+    // collect the 2d elements of the original mesh; line-elements are ignored
+    std::vector<MeshLib::Element const*> sfc_elems;
+    for (auto const* const elem : elems)
+    {
+        if (elem->getDimension() < 2)
+        {
+            continue;
+        }
+        if (elem->getGeomType() != MeshLib::MeshElemType::TRIANGLE &&
+            elem->getGeomType() != MeshLib::MeshElemType::QUAD)
+        {
+            OGS_FATAL("MeshLayerMapper: Unknown element type to extrude.");
+        }
+        sfc_elems.push_back(elem);
+    }
+    const std::size_t nElems(sfc_elems.size());
+
     std::vector<MeshLib::Node*> new_nodes(nNodes + (nLayers * nNodes));
-    std::vector<MeshLib::Element*> new_elems;
-    new_elems.reserve(nElems * nLayers);
+    std::vector<MeshLib::Element*> new_elems(nElems * nLayers);
     MeshLib::Properties properties;
     auto* const materials = properties.createNewPropertyVector<int>(
         "MaterialIDs", MeshLib::MeshItemType::Cell);
@@ -72,64 +84,58 @@ MeshLib::Mesh* MeshLayerMapper::createStaticLayers(MeshLib::Mesh const& mesh, st
         ERR("Could not create PropertyVector object 'MaterialIDs'.");
         return nullptr;
     }
+    materials->resize(nElems * nLayers);
 
-    materials->reserve(nElems * nLayers);
-    double z_offset (0.0);
+    // z-offsets of the layers' nodes
+    std::vector<double> z_offsets(nLayers + 1, 0.0);
+    for (std::size_t layer_id = 1; layer_id <= nLayers; ++layer_id)
+    {
+        z_offsets[layer_id] = z_offsets[layer_id - 1] + thickness[layer_id - 1];
+    }
 
-    for (unsigned layer_id = 0; layer_id <= nLayers; ++layer_id)
+    // add nodes for all layers; the nodes of all layers are independent
+    auto const n_new_nodes = static_cast<long long>(new_nodes.size());
+#pragma omp parallel for
+    for (long long k = 0; k < n_new_nodes; ++k)
     {
-        // add nodes for new layer
-        unsigned node_offset (nNodes * layer_id);
-        if (layer_id > 0)
-        {
-            z_offset += thickness[layer_id - 1];
-        }
+        auto const layer_id = static_cast<std::size_t>(k) / nNodes;
+        MeshLib::Node const& node = *nodes[static_cast<std::size_t>(k) % nNodes];
+        new_nodes[k] = new MeshLib::Node(node[0], node[1],
+                                         node[2] - z_offsets[layer_id]);
+    }
 
-        std::transform(nodes.cbegin(), nodes.cend(), new_nodes.begin() + node_offset,
-            [&z_offset](MeshLib::Node* node){ return new MeshLib::Node((*node)[0], (*node)[1], (*node)[2]-z_offset); });
+    // create prism or hex elements connecting each layer with the one above;
+    // element k of the layer below layer_id is at position
+    // (layer_id-1)*nElems + k
+    auto const n_new_elems = static_cast<long long>(new_elems.size());
+#pragma omp parallel for
+    for (long long k = 0; k < n_new_elems; ++k)
+    {
+        auto const layer_id = static_cast<std::size_t>(k) / nElems + 1;
+        const MeshLib::Element* sfc_elem(
+            sfc_elems[static_cast<std::size_t>(k) % nElems]);
+        const std::size_t node_offset(nNodes * (layer_id - 1));
+
+        const unsigned nElemNodes(sfc_elem->getNumberOfBaseNodes());
+        auto** e_nodes = new MeshLib::Node*[2 * nElemNodes];
 
-        // starting with 2nd layer create prism or hex elements connecting the last layer with the current one
-        if (layer_id == 0)
+        for (unsigned j=0; j<nElemNodes; ++j)
         {
-            continue;
+            const std::size_t node_id = sfc_elem->getNode(j)->getID() + node_offset;
+            e_nodes[j] = new_nodes[node_id+nNodes];
+            e_nodes[j+nElemNodes] = new_nodes[node_id];
         }
-
-        node_offset -= nNodes;
-        const unsigned mat_id (nLayers - layer_id);
-
-        for (unsigned i = 0; i < nOrgElems; ++i)
+        if (sfc_elem->getGeomType() == MeshLib::MeshElemType::TRIANGLE)
         {
-            const MeshLib::Element* sfc_elem( elems[i] );
-            if (sfc_elem->getDimension() < 2)
-            {  // ignore line-elements
-                continue;
-            }
-
-            const unsigned nElemNodes(sfc_elem->getNumberOfBaseNodes());
-            auto** e_nodes = new MeshLib::Node*[2 * nElemNodes];
-
-            for (unsigned j=0; j<nElemNodes; ++j)
-            {
-                const unsigned node_id = sfc_elem->getNode(j)->getID() + node_offset;
-                e_nodes[j] = new_nodes[node_id+nNodes];
-                e_nodes[j+nElemNodes] = new_nodes[node_id];
-            }
-            if (sfc_elem->getGeomType() == MeshLib::MeshElemType::TRIANGLE)
-            {
-                // extrude triangles to prism
-                new_elems.push_back(new MeshLib::Prism(e_nodes));
-            }
-            else if (sfc_elem->getGeomType() == MeshLib::MeshElemType::QUAD)
-            {
-                // extrude quads to hexes
-                new_elems.push_back(new MeshLib::Hex(e_nodes));
-            }
-            else
-            {
-                OGS_FATAL("MeshLayerMapper: Unknown element type to extrude.");
-            }
-            materials->push_back(mat_id);
+            // extrude triangles to prism
+            new_elems[k] = new MeshLib::Prism(e_nodes);
+        }
+        else
+        {
+            // extrude quads to hexes
+            new_elems[k] = new MeshLib::Hex(e_nodes);
         }
+        (*materials)[k] = static_cast<int>(nLayers - layer_id);
     }
     return new MeshLib::Mesh(mesh_name, new_nodes, new_elems, properties);
 }
@@ -172,9 +178,12 @@ bool MeshLayerMapper::createRasterLayers(
 
     // add bottom layer
     std::vector<MeshLib::Node*> const& nodes = bottom->getNodes();
-    for (MeshLib::Node* node : nodes)
+    _nodes.resize(nNodes);
+    auto const n_nodes = static_cast<long long>(nNodes);
+#pragma omp parallel for
+    for (long long i = 0; i < n_nodes; ++i)
     {
-        _nodes.push_back(new MeshLib::Node(*node));
+        _nodes[i] = new MeshLib::Node(*nodes[i]);
     }
 
     // add the other layers
@@ -199,18 +208,28 @@ void MeshLayerMapper::addLayerToMesh(const MeshLib::Mesh &dem_mesh, unsigned lay
     std::vector<MeshLib::Node*> const& nodes = dem_mesh.getNodes();
     int const last_layer_node_offset = layer_id * nNodes;
 
-    // add nodes for new layer
-    for (std::size_t i = 0; i < nNodes; ++i)
+    // add nodes for new layer; they only depend on the last layer's nodes
+    std::size_t const new_layer_node_offset = _nodes.size();
+    _nodes.resize(new_layer_node_offset + nNodes);
+    auto const n_nodes = static_cast<long long>(nNodes);
+#pragma omp parallel for
+    for (long long i = 0; i < n_nodes; ++i)
     {
-        _nodes.push_back(getNewLayerNode(*nodes[i],
-                                         *_nodes[last_layer_node_offset + i],
-                                         raster, _nodes.size()));
+        _nodes[new_layer_node_offset + i] =
+            getNewLayerNode(*nodes[i], *_nodes[last_layer_node_offset + i],
+                            raster, new_layer_node_offset + i);
     }
 
     std::vector<MeshLib::Element*> const& elems = dem_mesh.getElements();
     std::size_t const nElems (dem_mesh.getNumberOfElements());
 
-    for (std::size_t i=0; i<nElems; ++i)
+    // Depending on the collapsed nodes a triangle is extruded to a prism, a
+    // pyramid, a tetrahedron, or to nothing. The elements are created in
+    // parallel and appended in the order of the triangles afterwards.
+    std::vector<MeshLib::Element*> new_elements(nElems, nullptr);
+    auto const n_elems = static_cast<long long>(nElems);
+#pragma omp parallel for
+    for (long long i = 0; i < n_elems; ++i)
     {
         MeshLib::Element* elem (elems[i]);
         if (elem->getGeomType() != MeshLib::MeshElemType::TRIANGLE)
@@ -238,8 +257,7 @@ void MeshLayerMapper::addLayerToMesh(const MeshLib::Mesh &dem_mesh, unsigned lay
         switch (node_counter)
         {
         case 6:
-            _elements.push_back(new MeshLib::Prism(new_elem_nodes));
-            _materials.push_back(layer_id);
+            new_elements[i] = new MeshLib::Prism(new_elem_nodes);
             break;
         case 5:
             std::array<MeshLib::Node*, 5> pyramid_nodes;
@@ -248,19 +266,26 @@ void MeshLayerMapper::addLayerToMesh(const MeshLib::Mesh &dem_mesh, unsigned lay
             pyramid_nodes[2] = new_elem_nodes[pyramid_base[missing_idx][2]];
             pyramid_nodes[3] = new_elem_nodes[pyramid_base[missing_idx][3]];
             pyramid_nodes[4] = new_elem_nodes[missing_idx];
-            _elements.push_back(new MeshLib::Pyramid(pyramid_nodes));
-            _materials.push_back(layer_id);
+            new_elements[i] = new MeshLib::Pyramid(pyramid_nodes);
             break;
         case 4:
             std::array<MeshLib::Node*, 4> tet_nodes;
             std::copy(new_elem_nodes.begin(), new_elem_nodes.begin() + node_counter, tet_nodes.begin());
-            _elements.push_back(new MeshLib::Tet(tet_nodes));
-            _materials.push_back(layer_id);
+            new_elements[i] = new MeshLib::Tet(tet_nodes);
             break;
         default:
             continue;
         }
     }
+
+    for (auto* const new_element : new_elements)
+    {
+        if (new_element != nullptr)
+        {
+            _elements.push_back(new_element);
+            _materials.push_back(layer_id);
+        }
+    }
 }
 
 bool MeshLayerMapper::layerMapping(MeshLib::Mesh &new_mesh, GeoLib::Raster const& raster, double noDataReplacementValue = 0.0)
@@ -279,9 +304,10 @@ bool MeshLayerMapper::layerMapping(MeshLib::Mesh &new_mesh, GeoLib::Raster const
     const std::pair<double, double> xDim(x0, x0 + header.n_cols * delta); // extension in x-dimension
     const std::pair<double, double> yDim(y0, y0 + header.n_rows * delta); // extension in y-dimension
 
-    const std::size_t nNodes (new_mesh.getNumberOfNodes());
+    const auto nNodes = static_cast<long long>(new_mesh.getNumberOfNodes());
     const std::vector<MeshLib::Node*> &nodes = new_mesh.getNodes();
-    for (unsigned i = 0; i < nNodes; ++i)
+#pragma omp parallel for
+    for (long long i = 0; i < nNodes; ++i)
     {
         if (!raster.isPntOnRaster(*nodes[i]))
         {
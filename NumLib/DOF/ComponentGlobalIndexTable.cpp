@@ -0,0 +1,51 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "ComponentGlobalIndexTable.h"
+
+namespace NumLib
+{
+namespace detail
+{
+ComponentGlobalIndexTable::ComponentGlobalIndexTable(
+    ComponentGlobalIndexDict const& dict)
+{
+    _component_ids.reserve(dict.size());
+    _global_indices.reserve(dict.size());
+
+    // The ByLocation view is sorted by mesh id, item type, and item id. Lines
+    // of the same location retain their insertion order.
+    auto const& m = dict.get<ByLocation>();
+    for (auto const& line : m)
+    {
+        auto const& l = line.location;
+        if (_item_tables.empty() || _item_tables.back().mesh_id != l.mesh_id ||
+            _item_tables.back().item_type != l.item_type)
+        {
+            _item_tables.push_back({l.mesh_id, l.item_type, l.item_id,
+                                     {_global_indices.size()}});
+        }
+
+        // Close the ranges of all items up to and including the current one.
+        // Items without lines get empty ranges.
+        auto& item_table = _item_tables.back();
+        auto const i = l.item_id - item_table.first_item_id;
+        while (item_table.offsets.size() < i + 2)
+        {
+            item_table.offsets.push_back(_global_indices.size());
+        }
+
+        _component_ids.push_back(line.comp_id);
+        _global_indices.push_back(line.global_index);
+        item_table.offsets.back() = _global_indices.size();
+    }
+}
+
+}  // namespace detail
+}  // namespace NumLib
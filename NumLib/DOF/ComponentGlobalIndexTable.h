@@ -0,0 +1,132 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "ComponentGlobalIndexDict.h"
+
+namespace NumLib
+{
+/// \internal
+namespace detail
+{
+/// Flat, array based storage of the (location, component) to global index
+/// mapping.
+///
+/// The lines of the dictionary are stored grouped by location in the order of
+/// the dictionary's ByLocation view. For each mesh and mesh item type there is
+/// an offset table indexed by the item id, such that all lines of a location
+/// are found in constant time. Compared to the ComponentGlobalIndexDict, which
+/// is only used during construction, the lookups avoid the tree walks and the
+/// memory footprint per line is much smaller.
+class ComponentGlobalIndexTable final
+{
+public:
+    ComponentGlobalIndexTable() = default;
+
+    explicit ComponentGlobalIndexTable(ComponentGlobalIndexDict const& dict);
+
+    /// Number of stored (location, component) pairs.
+    std::size_t size() const { return _global_indices.size(); }
+
+    /// Returns the half-open range of line numbers stored for the given
+    /// location. The range is empty if the location is not stored.
+    std::pair<std::size_t, std::size_t> getLineRange(
+        MeshLib::Location const& l) const
+    {
+        for (auto const& item_table : _item_tables)
+        {
+            if (item_table.mesh_id != l.mesh_id ||
+                item_table.item_type != l.item_type)
+            {
+                continue;
+            }
+            if (l.item_id < item_table.first_item_id)
+            {
+                return {0, 0};
+            }
+            auto const i = l.item_id - item_table.first_item_id;
+            if (i + 1 >= item_table.offsets.size())
+            {
+                return {0, 0};
+            }
+            return {item_table.offsets[i], item_table.offsets[i + 1]};
+        }
+        return {0, 0};
+    }
+
+    /// Returns the global index of the given location and component or the
+    /// \c not_found value if the pair is not stored.
+    GlobalIndexType find(MeshLib::Location const& l, int const comp_id,
+                         GlobalIndexType const not_found) const
+    {
+        auto const range = getLineRange(l);
+        for (auto i = range.first; i < range.second; ++i)
+        {
+            if (_component_ids[i] == comp_id)
+            {
+                return _global_indices[i];
+            }
+        }
+        return not_found;
+    }
+
+    int getComponentID(std::size_t const line) const
+    {
+        return _component_ids[line];
+    }
+
+    GlobalIndexType getGlobalIndex(std::size_t const line) const
+    {
+        return _global_indices[line];
+    }
+
+    /// Calls \c f(location, comp_id, global_index) for each stored line.
+    template <typename Function>
+    void forEachLine(Function&& f) const
+    {
+        for (auto const& item_table : _item_tables)
+        {
+            for (std::size_t i = 0; i + 1 < item_table.offsets.size(); ++i)
+            {
+                MeshLib::Location const l{item_table.mesh_id,
+                                          item_table.item_type,
+                                          item_table.first_item_id + i};
+                for (auto line = item_table.offsets[i];
+                     line < item_table.offsets[i + 1];
+                     ++line)
+                {
+                    f(l, _component_ids[line], _global_indices[line]);
+                }
+            }
+        }
+    }
+
+private:
+    /// Offsets into the line arrays for the items of one mesh and item type.
+    struct ItemTable
+    {
+        std::size_t mesh_id;
+        MeshLib::MeshItemType item_type;
+        std::size_t first_item_id;
+        /// Lines of the item with id first_item_id + i are stored in
+        /// [offsets[i], offsets[i+1]).
+        std::vector<std::size_t> offsets;
+    };
+
+    std::vector<ItemTable> _item_tables;
+    std::vector<int> _component_ids;
+    std::vector<GlobalIndexType> _global_indices;
+};
+
+}  // namespace detail
+}  // namespace NumLib
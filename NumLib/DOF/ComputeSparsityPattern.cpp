@@ -9,6 +9,8 @@
 
 #include "ComputeSparsityPattern.h"
 
+#include <algorithm>
+
 #include "LocalToGlobalIndexMap.h"
 #include "MeshLib/NodeAdjacencyTable.h"
 
@@ -23,8 +25,21 @@ GlobalSparsityPattern computeSparsityPatternPETSc(
     auto const& npmesh =
         *static_cast<MeshLib::NodePartitionedMesh const*>(&mesh);
 
-    auto const max_nonzeroes =   dof_table.getNumberOfComponents()
-                               * npmesh.getMaximumNConnectedNodesToNode();
+    // Only the components defined on a node contribute to its rows. This
+    // bound is much smaller than the total number of components for
+    // variables living on small parts of the mesh, e.g., one per borehole
+    // heat exchanger.
+    std::size_t max_components_per_node = 0;
+    for (auto const* node : npmesh.getNodes())
+    {
+        MeshLib::Location const l(npmesh.getID(), MeshLib::MeshItemType::Node,
+                                  node->getID());
+        max_components_per_node = std::max(
+            max_components_per_node, dof_table.getGlobalIndices(l).size());
+    }
+
+    auto const max_nonzeroes =
+        max_components_per_node * npmesh.getMaximumNConnectedNodesToNode();
 
     // The sparsity pattern is misused here in the sense that it will only
     // contain a single value.
@@ -8,6 +8,8 @@
  */
 
 #include "DOFTableUtil.h"
+
+#include <algorithm>
 #include <cassert>
 
 namespace NumLib
@@ -85,6 +87,45 @@ double normInfinity(GlobalVector const& x, unsigned const global_component,
 #endif
     return res;
 }
+
+/// Checks if the global indices of the components of the given variable are
+/// consecutive for each node.
+bool haveConsecutiveComponentIndices(LocalToGlobalIndexMap const& dof_table,
+                                     int const variable_id)
+{
+    int const n_components =
+        dof_table.getNumberOfVariableComponents(variable_id);
+    auto const& mesh_subset = dof_table.getMeshSubset(variable_id, 0);
+    for (int component = 1; component < n_components; ++component)
+    {
+        if (dof_table.getMeshSubset(variable_id, component)
+                .getNumberOfNodes() != mesh_subset.getNumberOfNodes())
+        {
+            return false;
+        }
+    }
+
+    auto const mesh_id = mesh_subset.getMeshID();
+    for (auto const* node : mesh_subset.getNodes())
+    {
+        MeshLib::Location const l(mesh_id, MeshLib::MeshItemType::Node,
+                                  node->getID());
+        auto const index = dof_table.getGlobalIndex(l, variable_id, 0);
+        if (index < 0)
+        {  // ghost node
+            continue;
+        }
+        for (int component = 1; component < n_components; ++component)
+        {
+            if (dof_table.getGlobalIndex(l, variable_id, component) !=
+                index + component)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
 }  // anonymous namespace
 
 double getNonGhostNodalValue(GlobalVector const& x, MeshLib::Mesh const& mesh,
@@ -129,12 +170,7 @@ std::vector<GlobalIndexType> getIndices(
 
     // Local matrices and vectors will always be ordered by component
     // no matter what the order of the global matrix is.
-    for (int c = 0; c < dof_table.getNumberOfComponents(); ++c)
-    {
-        auto const& idcs = dof_table(mesh_item_id, c).rows;
-        indices.reserve(indices.size() + idcs.size());
-        indices.insert(indices.end(), idcs.begin(), idcs.end());
-    }
+    dof_table.appendIndices(mesh_item_id, indices);
 
     return indices;
 }
@@ -149,12 +185,7 @@ NumLib::LocalToGlobalIndexMap::RowColumnIndices getRowColumnIndices(
 
     // Local matrices and vectors will always be ordered by component,
     // no matter what the order of the global matrix is.
-    for (int c = 0; c < dof_table.getNumberOfComponents(); ++c)
-    {
-        auto const& idcs = dof_table(id, c).rows;
-        indices.reserve(indices.size() + idcs.size());
-        indices.insert(indices.end(), idcs.begin(), idcs.end());
-    }
+    dof_table.appendIndices(id, indices);
 
     return NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
 }
@@ -176,4 +207,102 @@ double norm(GlobalVector const& x, unsigned const global_component,
     }
 }
 
+std::vector<MathLib::FieldSplit> computeFieldSplits(
+    LocalToGlobalIndexMap const& dof_table,
+    std::vector<std::string> const& variable_names)
+{
+    int const n_variables = dof_table.getNumberOfVariables();
+    if (static_cast<std::size_t>(n_variables) != variable_names.size())
+    {
+        OGS_FATAL(
+            "The number of variable names (%d) differs from the number of "
+            "variables of the d.o.f. table (%d).",
+            variable_names.size(), n_variables);
+    }
+
+    std::vector<MathLib::FieldSplit> field_splits(n_variables);
+    for (int variable_id = 0; variable_id < n_variables; ++variable_id)
+    {
+        auto& field_split = field_splits[variable_id];
+        field_split.name = variable_names[variable_id];
+
+        int const n_components =
+            dof_table.getNumberOfVariableComponents(variable_id);
+        for (int component = 0; component < n_components; ++component)
+        {
+            auto const& mesh_subset =
+                dof_table.getMeshSubset(variable_id, component);
+            auto const mesh_id = mesh_subset.getMeshID();
+            for (auto const* node : mesh_subset.getNodes())
+            {
+                MeshLib::Location const l(mesh_id, MeshLib::MeshItemType::Node,
+                                          node->getID());
+                auto const index =
+                    dof_table.getGlobalIndex(l, variable_id, component);
+                // Skip ghost nodes and nodes without d.o.f.s.
+                if (index < 0 || index == NumLib::MeshComponentMap::nop)
+                {
+                    continue;
+                }
+                field_split.indices.push_back(index);
+            }
+        }
+
+        std::sort(field_split.indices.begin(), field_split.indices.end());
+
+        if (n_components > 1 &&
+            haveConsecutiveComponentIndices(dof_table, variable_id))
+        {
+            field_split.block_size = n_components;
+        }
+    }
+    return field_splits;
+}
+
+int computeInterleavedBlockSize(LocalToGlobalIndexMap const& dof_table)
+{
+    int const n_components = dof_table.getNumberOfComponents();
+    auto const is_interleaved = [&]() {
+        auto const& mesh_subset = dof_table.getMeshSubset(0);
+        for (int component = 1; component < n_components; ++component)
+        {
+            if (dof_table.getMeshSubset(component).getNumberOfNodes() !=
+                mesh_subset.getNumberOfNodes())
+            {
+                return false;
+            }
+        }
+
+        auto const mesh_id = mesh_subset.getMeshID();
+        for (auto const* node : mesh_subset.getNodes())
+        {
+            MeshLib::Location const l(mesh_id, MeshLib::MeshItemType::Node,
+                                      node->getID());
+            auto const index = dof_table.getGlobalIndex(l, 0);
+            if (index < 0)
+            {  // ghost node
+                continue;
+            }
+            for (int component = 1; component < n_components; ++component)
+            {
+                if (dof_table.getGlobalIndex(l, component) != index + component)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+
+    int block_size = n_components > 1 && is_interleaved() ? n_components : 1;
+#ifdef USE_PETSC
+    // The block size of a matrix must be the same on all ranks.
+    int global_block_size;
+    MPI_Allreduce(&block_size, &global_block_size, 1, MPI_INT, MPI_MIN,
+                  PETSC_COMM_WORLD);
+    block_size = global_block_size;
+#endif
+    return block_size;
+}
+
 }  // namespace NumLib
@@ -11,6 +11,7 @@
 
 #include "MathLib/LinAlg/LinAlg.h"
 #include "MathLib/LinAlg/LinAlgEnums.h"
+#include "MathLib/LinAlg/MatrixSpecifications.h"
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
 
 namespace NumLib
@@ -50,6 +51,20 @@ double norm(GlobalVector const& x, unsigned const global_component,
             MathLib::VecNormType norm_type,
             LocalToGlobalIndexMap const& dof_table, MeshLib::Mesh const& mesh);
 
+/// Collects for each variable of the \c dof_table the global indices of its
+/// non-ghost degrees of freedom. The \c variable_names are used as names of
+/// the field splits.
+std::vector<MathLib::FieldSplit> computeFieldSplits(
+    LocalToGlobalIndexMap const& dof_table,
+    std::vector<std::string> const& variable_names);
+
+/// Returns the number of all components of the \c dof_table if the
+/// d.o.f.s of all variables are interleaved, i.e., if all components are
+/// defined on the same nodes and the d.o.f.s of each node are numbered
+/// consecutively. Otherwise one is returned. In parallel runs the result is
+/// the same on all ranks.
+int computeInterleavedBlockSize(LocalToGlobalIndexMap const& dof_table);
+
 /// Copies part of a global vector for the given variable into output_vector
 /// while applying a function to each value.
 ///
@@ -37,6 +37,37 @@ int LocalToGlobalIndexMap::getGlobalComponent(int const variable_id,
     return _variable_component_offsets[variable_id] + component_id;
 }
 
+void LocalToGlobalIndexMap::setIndices(std::size_t const mesh_item_id,
+                                       int const component_id,
+                                       LineIndex&& indices)
+{
+    auto& row = _rows[mesh_item_id];
+    auto const it = std::lower_bound(
+        row.begin(), row.end(), component_id,
+        [](ComponentIndices const& c, int const id) {
+            return c.component_id < id;
+        });
+    if (it != row.end() && it->component_id == component_id)
+    {
+        if (indices.empty())
+        {
+            row.erase(it);
+        }
+        else
+        {
+            it->indices = std::move(indices);
+            it->indices.shrink_to_fit();
+        }
+        return;
+    }
+    if (indices.empty())
+    {
+        return;
+    }
+    indices.shrink_to_fit();
+    row.insert(it, {component_id, std::move(indices)});
+}
+
 template <typename ElementIterator>
 void LocalToGlobalIndexMap::findGlobalIndicesWithElementID(
     ElementIterator first, ElementIterator last,
@@ -65,8 +96,7 @@ void LocalToGlobalIndexMap::findGlobalIndicesWithElementID(
             indices.push_back(_mesh_component_map.getGlobalIndex(l, comp_id));
         }
 
-        indices.shrink_to_fit();
-        _rows((*e)->getID(), comp_id_write) = std::move(indices);
+        setIndices((*e)->getID(), comp_id_write, std::move(indices));
     }
 }
 
@@ -76,7 +106,7 @@ void LocalToGlobalIndexMap::findGlobalIndices(
     std::vector<MeshLib::Node*> const& nodes, std::size_t const mesh_id,
     const int comp_id, const int comp_id_write)
 {
-    _rows.resize(std::distance(first, last), _mesh_subsets.size());
+    _rows.resize(std::distance(first, last));
 
     std::unordered_set<MeshLib::Node*> const set_nodes(nodes.begin(), nodes.end());
 
@@ -107,8 +137,7 @@ void LocalToGlobalIndexMap::findGlobalIndices(
             indices.push_back(global_index);
         }
 
-        indices.shrink_to_fit();
-        _rows(elem_id, comp_id_write) = std::move(indices);
+        setIndices(elem_id, comp_id_write, std::move(indices));
     }
 }
 
@@ -170,7 +199,7 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
             max_elem_id = std::max(max_elem_id, e->getID());
         }
     }
-    _rows.resize(max_elem_id + 1, _mesh_subsets.size());
+    _rows.resize(max_elem_id + 1);
 
     for (int variable_id = 0; variable_id < static_cast<int>(vec_var_n_components.size());
          ++variable_id)
@@ -333,14 +362,36 @@ int LocalToGlobalIndexMap::getNumberOfComponents() const
 
 std::size_t LocalToGlobalIndexMap::size() const
 {
-    return _rows.rows();
+    return _rows.size();
 }
 
 LocalToGlobalIndexMap::RowColumnIndices LocalToGlobalIndexMap::operator()(
     std::size_t const mesh_item_id, const int component_id) const
 {
-    return RowColumnIndices(_rows(mesh_item_id, component_id),
-                            _columns(mesh_item_id, component_id));
+    static LineIndex const empty;
+
+    auto const& row = _rows[mesh_item_id];
+    auto const it = std::lower_bound(
+        row.begin(), row.end(), component_id,
+        [](ComponentIndices const& c, int const id) {
+            return c.component_id < id;
+        });
+    if (it == row.end() || it->component_id != component_id)
+    {
+        return RowColumnIndices(empty, empty);
+    }
+    return RowColumnIndices(it->indices, it->indices);
+}
+
+void LocalToGlobalIndexMap::appendIndices(
+    std::size_t const mesh_item_id, std::vector<GlobalIndexType>& indices) const
+{
+    auto const& row = _rows[mesh_item_id];
+    indices.reserve(indices.size() + getNumberOfElementDOF(mesh_item_id));
+    for (auto const& c : row)
+    {
+        indices.insert(indices.end(), c.indices.begin(), c.indices.end());
+    }
 }
 
 std::size_t
@@ -348,9 +399,9 @@ LocalToGlobalIndexMap::getNumberOfElementDOF(std::size_t const mesh_item_id) con
 {
     std::size_t ndof = 0;
 
-    for (Table::Index c = 0; c < _rows.cols(); ++c)
+    for (auto const& c : _rows[mesh_item_id])
     {
-        ndof += _rows(mesh_item_id, c).size();
+        ndof += c.indices.size();
     }
 
     return ndof;
@@ -359,34 +410,26 @@ LocalToGlobalIndexMap::getNumberOfElementDOF(std::size_t const mesh_item_id) con
 std::size_t
 LocalToGlobalIndexMap::getNumberOfElementComponents(std::size_t const mesh_item_id) const
 {
-    std::size_t n = 0;
-    for (Table::Index c = 0; c < _rows.cols(); ++c)
-    {
-        if (!_rows(mesh_item_id, c).empty())
-        {
-            n++;
-        }
-    }
-    return n;
+    return _rows[mesh_item_id].size();
 }
 
 std::vector<int> LocalToGlobalIndexMap::getElementVariableIDs(
     std::size_t const mesh_item_id) const
 {
     std::vector<int> vec;
-    for (int i = 0; i < getNumberOfVariables(); i++)
+    for (auto const& c : _rows[mesh_item_id])
     {
-        for (int j=0; j<getNumberOfVariableComponents(i); j++)
+        // The variable containing the global component.
+        auto const variable_id =
+            std::upper_bound(_variable_component_offsets.begin(),
+                             _variable_component_offsets.end(),
+                             c.component_id) -
+            _variable_component_offsets.begin() - 1;
+        if (vec.empty() || vec.back() != variable_id)
         {
-            auto comp_id = getGlobalComponent(i, j);
-            if (!_rows(mesh_item_id, comp_id).empty())
-            {
-                vec.push_back(i);
-            }
+            vec.push_back(static_cast<int>(variable_id));
         }
     }
-    std::sort(vec.begin(), vec.end());
-    vec.erase(std::unique(vec.begin(), vec.end()), vec.end());
 
     return vec;
 }
@@ -448,14 +491,14 @@ std::ostream& operator<<(std::ostream& os, LocalToGlobalIndexMap const& map)
     std::size_t const max_lines = 10;
     std::size_t lines_printed = 0;
 
-    os << "Rows of the local to global index map; " << map._rows.size()
+    os << "Rows of the local to global index map; " << map.size()
         << " rows\n";
     for (std::size_t e=0; e<map.size(); ++e)
     {
         os << "== e " << e << " ==\n";
         for (int c = 0; c < map.getNumberOfComponents(); ++c)
         {
-            auto const& line = map._rows(e, c);
+            auto const& line = map(e, c).rows;
 
             os << "c" << c << " { ";
             std::copy(line.cbegin(), line.cend(),
@@ -125,6 +125,11 @@ public:
     RowColumnIndices operator()(std::size_t const mesh_item_id,
                                 const int component_id) const;
 
+    /// Appends the global indices of all components defined on the given
+    /// mesh item to \c indices, ordered by component.
+    void appendIndices(std::size_t const mesh_item_id,
+                       std::vector<GlobalIndexType>& indices) const;
+
     std::size_t getNumberOfElementDOF(std::size_t const mesh_item_id) const;
 
     std::size_t getNumberOfElementComponents(std::size_t const mesh_item_id) const;
@@ -183,6 +188,9 @@ private:
                            std::size_t const mesh_id, const int comp_id,
                            const int comp_id_write);
 
+    void setIndices(std::size_t const mesh_item_id, int const component_id,
+                    LineIndex&& indices);
+
     template <typename ElementIterator>
     void findGlobalIndicesWithElementID(
         ElementIterator first, ElementIterator last,
@@ -193,14 +201,20 @@ private:
     std::vector<MeshLib::MeshSubset> _mesh_subsets;
     NumLib::MeshComponentMap _mesh_component_map;
 
-    using Table = Eigen::Matrix<LineIndex, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
-
-    /// Table contains for each element (first index) and each component (second index)
-    /// a vector (\c LineIndex) of indices in the global stiffness matrix or vector
-    Table _rows;
+    /// Indices in the global stiffness matrix or vector of one component on
+    /// a mesh item.
+    struct ComponentIndices
+    {
+        int component_id;
+        LineIndex indices;
+    };
 
-    /// \see _rows
-    Table const& _columns = _rows;
+    /// Contains for each element the indices of the components defined on
+    /// it, sorted by the component id. Components without indices are not
+    /// stored, such that memory and access costs per element do not depend
+    /// on the total number of components, e.g., for processes with a
+    /// variable per borehole heat exchanger.
+    std::vector<std::vector<ComponentIndices>> _rows;
 
     std::vector<int> const _variable_component_offsets;
 #ifndef NDEBUG
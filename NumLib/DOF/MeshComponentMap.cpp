@@ -27,6 +27,24 @@ using namespace detail;
 GlobalIndexType const MeshComponentMap::nop =
     std::numeric_limits<GlobalIndexType>::max();
 
+#ifndef USE_PETSC
+/// Assigns consecutive global indices to the lines of the dictionary ordered
+/// by location.
+static void renumberByLocation(ComponentGlobalIndexDict& dict,
+                               GlobalIndexType offset = 0)
+{
+    GlobalIndexType global_index = offset;
+
+    auto &m = dict.get<ByLocation>(); // view as sorted by mesh item
+    for (auto itr_mesh_item=m.begin(); itr_mesh_item!=m.end(); ++itr_mesh_item)
+    {
+        Line pos = *itr_mesh_item;
+        pos.global_index = global_index++;
+        m.replace(itr_mesh_item, pos);
+    }
+}
+#endif
+
 #ifdef USE_PETSC
 MeshComponentMap::MeshComponentMap(
     std::vector<MeshLib::MeshSubset> const& components, ComponentOrder order)
@@ -42,6 +60,7 @@ MeshComponentMap::MeshComponentMap(
     }
 
     // construct dict (and here we number global_index by component type)
+    ComponentGlobalIndexDict dict;
     int comp_id = 0;
     _num_global_dof = 0;
     _num_local_dof = 0;
@@ -82,19 +101,22 @@ MeshComponentMap::MeshComponentMap(
             else
                 _num_local_dof++;
 
-            _dict.insert(Line(Location(mesh_id, MeshLib::MeshItemType::Node, j),
-                              comp_id, global_id));
+            dict.insert(Line(Location(mesh_id, MeshLib::MeshItemType::Node, j),
+                             comp_id, global_id));
         }
 
         _num_global_dof += mesh.getNumberOfGlobalNodes();
         comp_id++;
     }
+
+    _table = ComponentGlobalIndexTable(dict);
 }
 #else
 MeshComponentMap::MeshComponentMap(
     std::vector<MeshLib::MeshSubset> const& components, ComponentOrder order)
 {
     // construct dict (and here we number global_index by component type)
+    ComponentGlobalIndexDict dict;
     GlobalIndexType global_index = 0;
     int comp_id = 0;
     for (auto const& c : components)
@@ -103,18 +125,20 @@ MeshComponentMap::MeshComponentMap(
         // mesh items are ordered first by node, cell, ....
         for (std::size_t j = 0; j < c.getNumberOfNodes(); j++)
         {
-            _dict.insert(Line(
+            dict.insert(Line(
                 Location(mesh_id, MeshLib::MeshItemType::Node, c.getNodeID(j)),
                 comp_id, global_index++));
         }
         comp_id++;
     }
-    _num_local_dof = _dict.size();
+    _num_local_dof = dict.size();
 
     if (order == ComponentOrder::BY_LOCATION)
     {
-        renumberByLocation();
+        renumberByLocation(dict);
     }
+
+    _table = ComponentGlobalIndexTable(dict);
 }
 #endif // end of USE_PETSC
 
@@ -203,55 +227,32 @@ MeshComponentMap MeshComponentMap::getSubset(
     return MeshComponentMap(subset_dict);
 }
 
-void MeshComponentMap::renumberByLocation(GlobalIndexType offset)
-{
-    GlobalIndexType global_index = offset;
-
-    auto &m = _dict.get<ByLocation>(); // view as sorted by mesh item
-    for (auto itr_mesh_item=m.begin(); itr_mesh_item!=m.end(); ++itr_mesh_item)
-    {
-        Line pos = *itr_mesh_item;
-        pos.global_index = global_index++;
-        m.replace(itr_mesh_item, pos);
-    }
-}
-
 std::vector<int> MeshComponentMap::getComponentIDs(const Location& l) const
 {
-    auto const &m = _dict.get<ByLocation>();
-    auto const p = m.equal_range(Line(l));
+    auto const range = _table.getLineRange(l);
     std::vector<int> vec_compID;
-    for (auto itr = p.first; itr != p.second; ++itr)
+    vec_compID.reserve(range.second - range.first);
+    for (auto line = range.first; line < range.second; ++line)
     {
-        vec_compID.push_back(itr->comp_id);
+        vec_compID.push_back(_table.getComponentID(line));
     }
     return vec_compID;
 }
 
-Line MeshComponentMap::getLine(Location const& l, int const comp_id) const
-{
-    auto const &m = _dict.get<ByLocationAndComponent>();
-    auto const itr = m.find(Line(l, comp_id));
-    assert(itr != m.end());     // The line must exist in the current dictionary.
-    return *itr;
-}
-
 GlobalIndexType MeshComponentMap::getGlobalIndex(Location const& l,
                                                  int const comp_id) const
 {
-    auto const &m = _dict.get<ByLocationAndComponent>();
-    auto const itr = m.find(Line(l, comp_id));
-    return itr!=m.end() ? itr->global_index : nop;
+    return _table.find(l, comp_id, nop);
 }
 
 std::vector<GlobalIndexType> MeshComponentMap::getGlobalIndices(const Location &l) const
 {
-    auto const &m = _dict.get<ByLocation>();
-    auto const p = m.equal_range(Line(l));
+    auto const range = _table.getLineRange(l);
     std::vector<GlobalIndexType> global_indices;
-    for (auto itr = p.first; itr != p.second; ++itr)
+    global_indices.reserve(range.second - range.first);
+    for (auto line = range.first; line < range.second; ++line)
     {
-        global_indices.push_back(itr->global_index);
+        global_indices.push_back(_table.getGlobalIndex(line));
     }
     return global_indices;
 }
@@ -265,13 +266,12 @@ std::vector<GlobalIndexType> MeshComponentMap::getGlobalIndicesByLocation(
     std::vector<GlobalIndexType> global_indices;
     global_indices.reserve(ls.size());
 
-    auto const &m = _dict.get<ByLocation>();
     for (const auto& l : ls)
     {
-        auto const p = m.equal_range(Line(l));
-        for (auto itr = p.first; itr != p.second; ++itr)
+        auto const range = _table.getLineRange(l);
+        for (auto line = range.first; line < range.second; ++line)
         {
-            global_indices.push_back(itr->global_index);
+            global_indices.push_back(_table.getGlobalIndex(line));
         }
     }
 
@@ -287,13 +287,13 @@ std::vector<GlobalIndexType> MeshComponentMap::getGlobalIndicesByComponent(
     pairs.reserve(ls.size());
 
     // Create a sub dictionary containing all lines with location from ls.
-    auto const &m = _dict.get<ByLocation>();
     for (const auto& l : ls)
     {
-        auto const p = m.equal_range(Line(l));
-        for (auto itr = p.first; itr != p.second; ++itr)
+        auto const range = _table.getLineRange(l);
+        for (auto line = range.first; line < range.second; ++line)
         {
-            pairs.emplace_back(itr->comp_id, itr->global_index);
+            pairs.emplace_back(_table.getComponentID(line),
+                               _table.getGlobalIndex(line));
         }
     }
 
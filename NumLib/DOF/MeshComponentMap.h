@@ -16,7 +16,7 @@
 
 #include "MeshLib/MeshSubset.h"
 
-#include "ComponentGlobalIndexDict.h"
+#include "ComponentGlobalIndexTable.h"
 
 namespace NumLib
 {
@@ -60,7 +60,7 @@ public:
     /// The number of dofs including the those located in the ghost nodes.
     std::size_t dofSizeWithGhosts() const
     {
-        return _dict.size();
+        return _table.size();
     }
 
     /// Component ids at given location \c l.
@@ -149,35 +149,26 @@ public:
     static NUMLIB_EXPORT GlobalIndexType const nop;
 
 #ifndef NDEBUG
-    const detail::ComponentGlobalIndexDict& getDictionary() const
-    {
-        return _dict;
-    }
-
     friend std::ostream& operator<<(std::ostream& os, MeshComponentMap const& m)
     {
-        os << "Dictionary size: " << m._dict.size() << "\n";
-        for (auto l : m._dict)
-            os << l << "\n";
+        os << "Dictionary size: " << m._table.size() << "\n";
+        m._table.forEachLine(
+            [&os](Location const& l, int const comp_id,
+                  GlobalIndexType const global_index) {
+                os << detail::Line(l, comp_id, global_index) << "\n";
+            });
         return os;
     }
 #endif  // NDEBUG
 
 private:
     /// Private constructor used by internally created mesh component maps.
-    explicit MeshComponentMap(detail::ComponentGlobalIndexDict& dict)
-        : _dict(dict)
+    explicit MeshComponentMap(detail::ComponentGlobalIndexDict const& dict)
+        : _table(dict)
     { }
 
-    /// Looks up if a line is already stored in the dictionary.
-    /// \attention The line for the location l and component id must exist,
-    /// the behaviour is undefined otherwise.
-    /// \return a copy of the line.
-    detail::Line getLine(Location const& l, int const comp_id) const;
-
-    void renumberByLocation(GlobalIndexType offset=0);
-
-    detail::ComponentGlobalIndexDict _dict;
+    /// Flat lookup table built from the dictionary after its construction.
+    detail::ComponentGlobalIndexTable _table;
 
     /// Number of local unknowns excluding those associated
     /// with ghost nodes (for domain decomposition).
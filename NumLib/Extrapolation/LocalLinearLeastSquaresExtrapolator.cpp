@@ -50,51 +50,68 @@ void LocalLinearLeastSquaresExtrapolator::extrapolate(
     auto const num_nodal_dof_result =
         _dof_table_single_component.dofSizeWithoutGhosts() * num_components;
 
-    std::vector<GlobalIndexType> ghost_indices;
-    {  // Create num_components times version of ghost_indices arranged by
-       // location. For example for 3 components and ghost_indices {5,6,10} we
-       // compute {15, 16, 17,  18, 19, 20,  30, 31, 32}.
-        auto const& single_component_ghost_indices =
-            _dof_table_single_component.getGhostIndices();
-        auto const single_component_ghost_indices_size =
-            single_component_ghost_indices.size();
-        ghost_indices.reserve(single_component_ghost_indices_size *
-                              num_components);
-        for (unsigned i = 0; i < single_component_ghost_indices_size; ++i)
-        {
-            for (unsigned c = 0; c < num_components; ++c)
-            {
-                ghost_indices.push_back(
-                    single_component_ghost_indices[i] * num_components + c);
-            }
-        }
-    }
-
-    if (!_nodal_values ||
+    // The nodal values and the counts are kept for each number of components,
+    // such that extrapolating variables of different numbers of components
+    // alternately does not invalidate them.
+    auto& nodal_values_and_counts = _nodal_values_and_counts[num_components];
+    auto& nodal_values = nodal_values_and_counts.nodal_values;
+    auto& counts = nodal_values_and_counts.counts;
+
+    // The vectors are only recreated if the d.o.f. table has changed.
+    if (!nodal_values ||
 #ifdef USE_PETSC
-        _nodal_values->getLocalSize() + _nodal_values->getGhostSize()
+        nodal_values->getLocalSize() + nodal_values->getGhostSize()
 #else
-        _nodal_values->size()
+        nodal_values->size()
 #endif
             != static_cast<GlobalIndexType>(num_nodal_dof_result))
     {
-        _nodal_values = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(
+        std::vector<GlobalIndexType> ghost_indices;
+        {  // Create num_components times version of ghost_indices arranged by
+           // location. For example for 3 components and ghost_indices {5,6,10}
+           // we compute {15, 16, 17,  18, 19, 20,  30, 31, 32}.
+            auto const& single_component_ghost_indices =
+                _dof_table_single_component.getGhostIndices();
+            auto const single_component_ghost_indices_size =
+                single_component_ghost_indices.size();
+            ghost_indices.reserve(single_component_ghost_indices_size *
+                                  num_components);
+            for (unsigned i = 0; i < single_component_ghost_indices_size; ++i)
+            {
+                for (unsigned c = 0; c < num_components; ++c)
+                {
+                    ghost_indices.push_back(
+                        single_component_ghost_indices[i] * num_components +
+                        c);
+                }
+            }
+        }
+
+        nodal_values = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(
             {num_nodal_dof_result, num_nodal_dof_result, &ghost_indices,
              nullptr});
+        counts.reset();
     }
+    _nodal_values = nodal_values.get();
     _nodal_values->setZero();
 
     // counts the writes to each nodal value, i.e., the summands in order to
-    // compute the average afterwards
-    auto counts =
-        MathLib::MatrixVectorTraits<GlobalVector>::newInstance(*_nodal_values);
-    counts->setZero();
+    // compute the average afterwards. The counts only depend on the mesh,
+    // hence they are computed only once for each number of components.
+    bool const compute_counts = !counts;
+    if (compute_counts)
+    {
+        counts = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(
+            *_nodal_values);
+        counts->setZero();
+    }
 
     auto const size = extrapolatables.size();
     for (std::size_t i = 0; i < size; ++i)
     {
         extrapolateElement(i, num_components, extrapolatables, t,
-                           current_solution, dof_table, *counts);
+                           current_solution, dof_table,
+                           compute_counts ? counts.get() : nullptr);
     }
     MathLib::LinAlg::finalizeAssembly(*_nodal_values);
 
@@ -143,7 +160,7 @@ void LocalLinearLeastSquaresExtrapolator::extrapolateElement(
     const double t,
     GlobalVector const& current_solution,
     LocalToGlobalIndexMap const& dof_table,
-    GlobalVector& counts)
+    GlobalVector* const counts)
 {
     auto const& integration_point_values =
         extrapolatables.getIntegrationPointValues(
@@ -235,14 +252,18 @@ void LocalLinearLeastSquaresExtrapolator::extrapolateElement(
             MathLib::toVector(integration_point_values);
 
         // Apply the pre-computed pseudo-inverse.
-        Eigen::VectorXd const nodal_values =
+        _nodal_values_element_cache.noalias() =
             cached_data.A_pinv * integration_point_values_vec;
 
         // TODO does that give rise to PETSc problems? E.g., writing to ghost
         // nodes? Furthermore: Is ghost nodes communication necessary for PETSc?
-        _nodal_values->add(global_indices, nodal_values);
-        counts.add(global_indices,
-                   std::vector<double>(global_indices.size(), 1.0));
+        _nodal_values->add(global_indices,
+                           _nodal_values_element_cache.data());
+        if (counts)
+        {
+            counts->add(global_indices,
+                        std::vector<double>(global_indices.size(), 1.0));
+        }
     }
     else
     {
@@ -250,10 +271,11 @@ void LocalLinearLeastSquaresExtrapolator::extrapolateElement(
             integration_point_values, num_components, num_int_pts);
 
         // Apply the pre-computed pseudo-inverse.
-        Eigen::MatrixXd const nodal_values =
+        _nodal_values_element_cache.noalias() =
             cached_data.A_pinv * integration_point_values_mat.transpose();
 
-        std::vector<GlobalIndexType> indices;
+        auto& indices = _indices_cache;
+        indices.clear();
         indices.reserve(num_components * global_indices.size());
 
         // _nodal_values is ordered location-wise
@@ -267,8 +289,11 @@ void LocalLinearLeastSquaresExtrapolator::extrapolateElement(
 
         // Nodal_values are passed as a raw pointer, because PETScVector and
         // EigenVector implementations differ slightly.
-        _nodal_values->add(indices, nodal_values.data());
-        counts.add(indices, std::vector<double>(indices.size(), 1.0));
+        _nodal_values->add(indices, _nodal_values_element_cache.data());
+        if (counts)
+        {
+            counts->add(indices, std::vector<double>(indices.size(), 1.0));
+        }
     }
 }
 
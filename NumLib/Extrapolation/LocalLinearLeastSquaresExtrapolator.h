@@ -78,11 +78,14 @@ public:
 
 private:
     //! Extrapolate one element.
+    //!
+    //! If \c counts is not null, the number of contributions to each nodal
+    //! value is added to it.
     void extrapolateElement(
         std::size_t const element_index, const unsigned num_components,
         ExtrapolatableElementCollection const& extrapolatables, const double t,
         GlobalVector const& current_solution,
-        LocalToGlobalIndexMap const& dof_table, GlobalVector& counts);
+        LocalToGlobalIndexMap const& dof_table, GlobalVector* const counts);
 
     //! Compute the residuals for one element
     void calculateResidualElement(
@@ -93,14 +96,30 @@ private:
         GlobalVector const& current_solution,
         LocalToGlobalIndexMap const& dof_table);
 
-    std::unique_ptr<GlobalVector> _nodal_values;  //!< extrapolated nodal values
+    //! Extrapolated nodal values of the last extrapolate() call, points into
+    //! _nodal_values_and_counts.
+    GlobalVector* _nodal_values = nullptr;
     std::unique_ptr<GlobalVector> _residuals;     //!< extrapolation residuals
 
     //! DOF table used for writing to global vectors.
     NumLib::LocalToGlobalIndexMap const& _dof_table_single_component;
 
+    struct NodalValuesAndCounts
+    {
+        std::unique_ptr<GlobalVector> nodal_values;
+        //! Number of elements contributing to each nodal value. It is assumed
+        //! that the extrapolatables always comprise the same elements.
+        std::unique_ptr<GlobalVector> counts;
+    };
+
+    //! Nodal values and counts for each number of components extrapolated so
+    //! far.
+    std::map<unsigned, NodalValuesAndCounts> _nodal_values_and_counts;
+
     //! Avoids frequent reallocations.
     std::vector<double> _integration_point_values_cache;
+    Eigen::MatrixXd _nodal_values_element_cache;
+    std::vector<GlobalIndexType> _indices_cache;
 
     //! Stores a matrix and its Moore-Penrose pseudo-inverse.
     struct CachedData
@@ -75,16 +75,29 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Picard>::solve(
         time_dirichlet += timer_dirichlet.elapsed();
         INFO("[time] Applying Dirichlet BCs took %g s.", time_dirichlet);
 
+        // If set, A is only the assembled part of the equation system.
+        auto const* const matrix_free_operator = sys.getMatrixFreeOperator();
+
         if (!sys.isLinear() && _convergence_criterion->hasResidualCheck()) {
             GlobalVector res;
-            LinAlg::matMult(A, x_new, res);  // res = A * x_new
+            if (matrix_free_operator)
+            {
+                matrix_free_operator->apply(x_new, res);
+            }
+            else
+            {
+                LinAlg::matMult(A, x_new, res);  // res = A * x_new
+            }
             LinAlg::axpy(res, -1.0, rhs);   // res -= rhs
             _convergence_criterion->checkResidual(res);
         }
 
         BaseLib::RunTime time_linear_solver;
         time_linear_solver.start();
-        bool iteration_succeeded = _linear_solver.solve(A, rhs, x_new);
+        bool iteration_succeeded =
+            matrix_free_operator
+                ? _linear_solver.solve(*matrix_free_operator, rhs, x_new)
+                : _linear_solver.solve(A, rhs, x_new);
         INFO("[time] Linear solver took %g s.", time_linear_solver.elapsed());
 
         if (!iteration_succeeded)
@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include "MathLib/LinAlg/MatrixFreeOperator.h"
+
 #include "EquationSystem.h"
 #include "Types.h"
 
@@ -103,6 +105,17 @@ public:
     //! \pre computeKnownSolutions() must have been called before.
     virtual void applyKnownSolutionsPicard(GlobalMatrix& A, GlobalVector& rhs,
                                            GlobalVector& x) const = 0;
+
+    //! Returns the operator of the linearized equation system if parts of it
+    //! are not assembled into \c A, or nullptr otherwise. The operator
+    //! includes \c A and the known solutions; it has to be used instead of
+    //! \c A.
+    //! \pre applyKnownSolutionsPicard() must have been called before.
+    virtual MathLib::MatrixFreeOperator<GlobalVector> const*
+    getMatrixFreeOperator() const
+    {
+        return nullptr;
+    }
 };
 
 //! @}
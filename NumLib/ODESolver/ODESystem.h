@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "MathLib/LinAlg/MatrixFreeOperator.h"
 #include "MathLib/LinAlg/MatrixVectorTraits.h"
 #include "NumLib/IndexValueVector.h"
 
@@ -63,6 +64,16 @@ public:
         (void)x;
         return nullptr;  // by default there are no known solutions
     }
+
+    //! Returns the part of \c K that is not assembled by assemble() but
+    //! applied element-wise, or nullptr if \c K is assembled completely.
+    //! The operator must reflect the state of the last assemble() call.
+    virtual MathLib::MatrixFreeOperator<GlobalVector> const*
+    getMatrixFreeOperator(int const process_id) const
+    {
+        (void)process_id;
+        return nullptr;  // by default everything is assembled
+    }
 };
 
 /*! Interface for a first-order implicit quasi-linear ODE.
@@ -0,0 +1,101 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "PicardMatrixFreeOperator.h"
+
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/MatrixVectorTraits.h"
+
+namespace
+{
+void setValues(GlobalVector& x, std::vector<GlobalIndexType> const& ids,
+               std::vector<double> const& values)
+{
+    for (std::size_t i = 0; i < ids.size(); ++i)
+    {
+        x.set(ids[i], values[i]);
+    }
+    MathLib::LinAlg::finalizeAssembly(x);
+}
+}  // namespace
+
+namespace NumLib
+{
+PicardMatrixFreeOperator::PicardMatrixFreeOperator(
+    MathLib::MatrixFreeOperator<GlobalVector> const& K_matrix_free)
+    : _K_matrix_free(K_matrix_free)
+{
+}
+
+void PicardMatrixFreeOperator::reset(GlobalMatrix const& A,
+                                     std::vector<GlobalIndexType>&& known_ids,
+                                     std::vector<double> const& known_values,
+                                     GlobalVector& rhs)
+{
+    namespace LinAlg = MathLib::LinAlg;
+
+    _A = &A;
+    _known_ids = std::move(known_ids);
+
+    if (!_x_tmp)
+    {
+        _x_tmp = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(rhs);
+        _y_tmp = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(rhs);
+    }
+
+    // rhs -= (A + K_mf) * x_known, where x_known is zero except for the known
+    // solutions.
+    LinAlg::set(*_x_tmp, 0.0);
+    setValues(*_x_tmp, _known_ids, known_values);
+    LinAlg::matMult(A, *_x_tmp, *_y_tmp);
+    LinAlg::axpy(rhs, -1.0, *_y_tmp);
+    _K_matrix_free.apply(*_x_tmp, *_y_tmp);
+    LinAlg::axpy(rhs, -1.0, *_y_tmp);
+
+    setValues(rhs, _known_ids, known_values);
+}
+
+void PicardMatrixFreeOperator::apply(GlobalVector const& x,
+                                     GlobalVector& y) const
+{
+    namespace LinAlg = MathLib::LinAlg;
+
+    // Zero the columns of the known solutions.
+    LinAlg::copy(x, *_x_tmp);
+    setValues(*_x_tmp, _known_ids,
+              std::vector<double>(_known_ids.size(), 0.0));
+    applyUnconstrained(*_x_tmp, y);
+
+    // Identity rows of the known solutions.
+    LinAlg::setLocalAccessibleVector(x);
+    setValues(y, _known_ids, x.get(_known_ids));
+}
+
+void PicardMatrixFreeOperator::getDiagonal(GlobalVector& d) const
+{
+    namespace LinAlg = MathLib::LinAlg;
+
+    _K_matrix_free.getDiagonal(d);
+    LinAlg::getDiagonal(*_A, *_y_tmp);
+    LinAlg::axpy(d, 1.0, *_y_tmp);
+
+    setValues(d, _known_ids, std::vector<double>(_known_ids.size(), 1.0));
+}
+
+void PicardMatrixFreeOperator::applyUnconstrained(GlobalVector const& x,
+                                                  GlobalVector& y) const
+{
+    namespace LinAlg = MathLib::LinAlg;
+
+    LinAlg::matMult(*_A, x, y);
+    _K_matrix_free.apply(x, *_y_tmp);
+    LinAlg::axpy(y, 1.0, *_y_tmp);
+}
+
+}  // namespace NumLib
@@ -0,0 +1,63 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "MathLib/LinAlg/GlobalMatrixVectorTypes.h"
+#include "MathLib/LinAlg/MatrixFreeOperator.h"
+
+namespace NumLib
+{
+//! \addtogroup ODESolver
+//! @{
+
+/*! The operator \f$ A + K_\mathrm{mf} \f$ of the linearized equation system
+ * of the Picard iteration, where \f$ A \f$ is assembled and
+ * \f$ K_\mathrm{mf} \f$ is applied matrix-free.
+ *
+ * The rows and columns of known solutions are replaced by the identity; the
+ * right-hand side is corrected accordingly in reset().
+ */
+class PicardMatrixFreeOperator final
+    : public MathLib::MatrixFreeOperator<GlobalVector>
+{
+public:
+    explicit PicardMatrixFreeOperator(
+        MathLib::MatrixFreeOperator<GlobalVector> const& K_matrix_free);
+
+    //! Sets the assembled part \c A of the operator and the known solutions
+    //! and applies the latter to \c rhs. \c A must outlive the next uses of
+    //! the operator.
+    void reset(GlobalMatrix const& A,
+               std::vector<GlobalIndexType>&& known_ids,
+               std::vector<double> const& known_values, GlobalVector& rhs);
+
+    void apply(GlobalVector const& x, GlobalVector& y) const override;
+
+    void getDiagonal(GlobalVector& d) const override;
+
+private:
+    //! Computes \f$ y = (A + K_\mathrm{mf}) x \f$ without regard to the known
+    //! solutions.
+    void applyUnconstrained(GlobalVector const& x, GlobalVector& y) const;
+
+    MathLib::MatrixFreeOperator<GlobalVector> const& _K_matrix_free;
+    GlobalMatrix const* _A = nullptr;
+    std::vector<GlobalIndexType> _known_ids;
+
+    // Work vectors.
+    std::unique_ptr<GlobalVector> _x_tmp;
+    std::unique_ptr<GlobalVector> _y_tmp;
+};
+
+//! @}
+}  // namespace NumLib
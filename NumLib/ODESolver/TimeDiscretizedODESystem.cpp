@@ -172,6 +172,21 @@ TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
         ode.getMatrixSpecifications(process_id), _K_id);
     _b = &NumLib::GlobalVectorProvider::provider.getVector(
         ode.getMatrixSpecifications(process_id), _b_id);
+
+    if (auto const* const K_matrix_free =
+            ode.getMatrixFreeOperator(process_id))
+    {
+        // Other translators need K itself, e.g., on the right-hand side.
+        if (dynamic_cast<MatrixTranslatorGeneral<ODETag> const*>(
+                _mat_trans.get()) == nullptr)
+        {
+            OGS_FATAL(
+                "Matrix-free operators can only be used with the backward "
+                "Euler or BDF time discretizations.");
+        }
+        _matrix_free_operator =
+            std::make_unique<PicardMatrixFreeOperator>(*K_matrix_free);
+    }
 }
 
 TimeDiscretizedODESystem<
@@ -224,7 +239,7 @@ void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
                               GlobalVector& rhs,
                               GlobalVector& x) const
 {
-    if (!_known_solutions)
+    if (!_known_solutions && !_matrix_free_operator)
     {
         return;
     }
@@ -232,11 +247,21 @@ void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
     using IndexType = MathLib::MatrixVectorTraits<GlobalMatrix>::Index;
     std::vector<IndexType> ids;
     std::vector<double> values;
-    for (auto const& bc : *_known_solutions)
+    if (_known_solutions)
     {
-        std::copy(bc.ids.cbegin(), bc.ids.cend(), std::back_inserter(ids));
-        std::copy(bc.values.cbegin(), bc.values.cend(),
-                  std::back_inserter(values));
+        for (auto const& bc : *_known_solutions)
+        {
+            std::copy(bc.ids.cbegin(), bc.ids.cend(), std::back_inserter(ids));
+            std::copy(bc.values.cbegin(), bc.values.cend(),
+                      std::back_inserter(values));
+        }
+    }
+
+    if (_matrix_free_operator)
+    {
+        // A is not complete; the known solutions are applied by the operator.
+        _matrix_free_operator->reset(A, std::move(ids), values, rhs);
+        return;
     }
     MathLib::applyKnownSolution(A, rhs, x, ids, values);
 }
@@ -14,6 +14,7 @@
 #include "MatrixTranslator.h"
 #include "NonlinearSystem.h"
 #include "ODESystem.h"
+#include "PicardMatrixFreeOperator.h"
 #include "TimeDiscretization.h"
 
 namespace NumLib
@@ -197,6 +198,12 @@ public:
     void applyKnownSolutionsPicard(GlobalMatrix& A, GlobalVector& rhs,
                                    GlobalVector& x) const override;
 
+    MathLib::MatrixFreeOperator<GlobalVector> const* getMatrixFreeOperator()
+        const override
+    {
+        return _matrix_free_operator.get();
+    }
+
     bool isLinear() const override
     {
         return _time_disc.isLinearTimeDisc() || _ode.isLinear();
@@ -242,6 +249,10 @@ private:
     std::size_t _M_id = 0u;  //!< ID of the \c _M matrix.
     std::size_t _K_id = 0u;  //!< ID of the \c _K matrix.
     std::size_t _b_id = 0u;  //!< ID of the \c _b vector.
+
+    //! Operator of the linearized equation system if the ODE applies parts
+    //! of \f$ K \f$ matrix-free, nullptr otherwise.
+    std::unique_ptr<PicardMatrixFreeOperator> _matrix_free_operator;
 };
 
 //! @}
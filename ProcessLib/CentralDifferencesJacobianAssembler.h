@@ -10,6 +10,8 @@
 #pragma once
 
 #include <memory>
+#include <Eigen/Dense>
+
 #include "AbstractJacobianAssembler.h"
 
 namespace BaseLib
@@ -66,6 +68,7 @@ private:
     std::vector<double> _local_K_data;
     std::vector<double> _local_b_data;
     std::vector<double> _local_x_perturbed_data;
+    Eigen::MatrixXd _local_Jac;
 };
 
 std::unique_ptr<CentralDifferencesJacobianAssembler>
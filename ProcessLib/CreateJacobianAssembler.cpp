@@ -13,6 +13,7 @@
 #include "AnalyticalJacobianAssembler.h"
 #include "CentralDifferencesJacobianAssembler.h"
 #include "CompareJacobiansJacobianAssembler.h"
+#include "ForwardDifferencesJacobianAssembler.h"
 
 namespace ProcessLib
 {
@@ -35,6 +36,10 @@ std::unique_ptr<AbstractJacobianAssembler> createJacobianAssembler(
     {
         return createCentralDifferencesJacobianAssembler(*config);
     }
+    if (type == "ForwardDifferences")
+    {
+        return createForwardDifferencesJacobianAssembler(*config);
+    }
     if (type == "CompareJacobians")
     {
         return createCompareJacobiansJacobianAssembler(*config);
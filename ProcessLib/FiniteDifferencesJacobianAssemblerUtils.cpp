@@ -0,0 +1,122 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "FiniteDifferencesJacobianAssemblerUtils.h"
+
+#include "BaseLib/ConfigTree.h"
+#include "BaseLib/Error.h"
+#include "MathLib/LinAlg/Eigen/EigenMapTools.h"
+
+namespace ProcessLib
+{
+namespace detail
+{
+void addFiniteDifferencesJacobianColumn(
+    std::vector<double> const& local_M_p_data,
+    std::vector<double> const& local_K_p_data,
+    std::vector<double> const& local_b_p_data,
+    std::vector<double> const& local_M_m_data,
+    std::vector<double> const& local_K_m_data,
+    std::vector<double> const& local_b_m_data,
+    Eigen::Ref<const Eigen::VectorXd> const& local_x,
+    Eigen::Ref<const Eigen::VectorXd> const& local_xdot,
+    double const inverse_dx, Eigen::Ref<Eigen::VectorXd> local_Jac_column)
+{
+    auto const num_r_c = local_Jac_column.size();
+
+    if (!local_M_p_data.empty())
+    {
+        auto const local_M_p =
+            MathLib::toMatrix(local_M_p_data, num_r_c, num_r_c);
+        auto const local_M_m =
+            MathLib::toMatrix(local_M_m_data, num_r_c, num_r_c);
+        local_Jac_column.noalias() +=
+            // dM/dxi * x_dot
+            (local_M_p - local_M_m) * local_xdot * inverse_dx;
+    }
+    if (!local_K_p_data.empty())
+    {
+        auto const local_K_p =
+            MathLib::toMatrix(local_K_p_data, num_r_c, num_r_c);
+        auto const local_K_m =
+            MathLib::toMatrix(local_K_m_data, num_r_c, num_r_c);
+        local_Jac_column.noalias() +=
+            // dK/dxi * x
+            (local_K_p - local_K_m) * local_x * inverse_dx;
+    }
+    if (!local_b_p_data.empty())
+    {
+        auto const local_b_p =
+            MathLib::toVector<Eigen::VectorXd>(local_b_p_data, num_r_c);
+        auto const local_b_m =
+            MathLib::toVector<Eigen::VectorXd>(local_b_m_data, num_r_c);
+        local_Jac_column.noalias() -=
+            // db/dxi
+            (local_b_p - local_b_m) * inverse_dx;
+    }
+}
+
+void checkNumberOfEpsilons(std::size_t const num_epsilons,
+                           std::size_t const num_local_dofs)
+{
+    if (num_local_dofs % num_epsilons != 0)
+    {
+        OGS_FATAL(
+            "The number of specified epsilons (%u) and the number of local "
+            "d.o.f.s (%u) do not match, i.e., the latter is not divisable by "
+            "the former.",
+            num_epsilons, num_local_dofs);
+    }
+}
+
+std::vector<double> parseAbsoluteEpsilons(BaseLib::ConfigTree const& config)
+{
+    // TODO make non-optional.
+    //! \ogs_file_special
+    auto rel_eps = config.getConfigParameterOptional<std::vector<double>>(
+        "relative_epsilons");
+    //! \ogs_file_special
+    auto comp_mag = config.getConfigParameterOptional<std::vector<double>>(
+        "component_magnitudes");
+
+    if (!!rel_eps != !!comp_mag)
+    {
+        OGS_FATAL(
+            "Either both or none of <relative_epsilons> and "
+            "<component_magnitudes> have to be specified.");
+    }
+
+    std::vector<double> abs_eps;
+
+    if (rel_eps)
+    {
+        if (rel_eps->size() != comp_mag->size())
+        {
+            OGS_FATAL(
+                "The numbers of components of <relative_epsilons> and "
+                "<component_magnitudes> do not match.");
+        }
+
+        abs_eps.resize(rel_eps->size());
+        for (std::size_t i = 0; i < rel_eps->size(); ++i)
+        {
+            abs_eps[i] = (*rel_eps)[i] * (*comp_mag)[i];
+        }
+    }
+    else
+    {
+        // By default 1e-8 is used as epsilon for all components.
+        // TODO: remove this default value.
+        abs_eps.emplace_back(1e-8);
+    }
+
+    return abs_eps;
+}
+}  // namespace detail
+}  // namespace ProcessLib
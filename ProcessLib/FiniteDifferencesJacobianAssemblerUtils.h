@@ -0,0 +1,55 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <vector>
+#include <Eigen/Dense>
+
+namespace BaseLib
+{
+class ConfigTree;
+}  // namespace BaseLib
+
+namespace ProcessLib
+{
+namespace detail
+{
+//! Adds the finite differences approximation of one column of the Jacobian,
+//! i.e., \f$(dM/dx_i\,\dot x + dK/dx_i\,x - db/dx_i)\f$, to \c
+//! local_Jac_column.
+//!
+//! The local matrices and vectors with suffix \c _p and \c _m have been
+//! assembled at the two perturbed (or perturbed and unperturbed) local
+//! solution vectors, which differ by \f$1 / \mathtt{inverse\_dx}\f$ in the
+//! \f$i\f$-th component. Empty matrices and vectors are skipped. Their
+//! differences are taken before multiplying with \c local_x or \c local_xdot
+//! such that entries that do not depend on \f$x_i\f$ cancel exactly.
+void addFiniteDifferencesJacobianColumn(
+    std::vector<double> const& local_M_p_data,
+    std::vector<double> const& local_K_p_data,
+    std::vector<double> const& local_b_p_data,
+    std::vector<double> const& local_M_m_data,
+    std::vector<double> const& local_K_m_data,
+    std::vector<double> const& local_b_m_data,
+    Eigen::Ref<const Eigen::VectorXd> const& local_x,
+    Eigen::Ref<const Eigen::VectorXd> const& local_xdot,
+    double const inverse_dx, Eigen::Ref<Eigen::VectorXd> local_Jac_column);
+
+//! Checks that the number of local d.o.f.s is divisible by the number of
+//! given epsilons, cf. CentralDifferencesJacobianAssembler.
+void checkNumberOfEpsilons(std::size_t const num_epsilons,
+                           std::size_t const num_local_dofs);
+
+//! Reads the optional <relative_epsilons> and <component_magnitudes> of a
+//! finite differences Jacobian assembler and returns their products, i.e., the
+//! absolute epsilons. Defaults to a single epsilon of 1e-8 if both are omitted.
+std::vector<double> parseAbsoluteEpsilons(BaseLib::ConfigTree const& config);
+}  // namespace detail
+}  // namespace ProcessLib
@@ -0,0 +1,121 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "ForwardDifferencesJacobianAssembler.h"
+#include "BaseLib/Error.h"
+#include "MathLib/LinAlg/Eigen/EigenMapTools.h"
+#include "FiniteDifferencesJacobianAssemblerUtils.h"
+#include "LocalAssemblerInterface.h"
+
+namespace ProcessLib
+{
+ForwardDifferencesJacobianAssembler::ForwardDifferencesJacobianAssembler(
+    std::vector<double>&& absolute_epsilons)
+    : _absolute_epsilons(std::move(absolute_epsilons))
+{
+    if (_absolute_epsilons.empty())
+    {
+        OGS_FATAL("No values for the absolute epsilons have been given.");
+    }
+}
+
+void ForwardDifferencesJacobianAssembler::assembleWithJacobian(
+    LocalAssemblerInterface& local_assembler, const double t,
+    const std::vector<double>& local_x_data,
+    const std::vector<double>& local_xdot_data, const double dxdot_dx,
+    const double dx_dx, std::vector<double>& local_M_data,
+    std::vector<double>& local_K_data, std::vector<double>& local_b_data,
+    std::vector<double>& local_Jac_data)
+{
+    detail::checkNumberOfEpsilons(_absolute_epsilons.size(),
+                                  local_x_data.size());
+
+    auto const num_r_c =
+        static_cast<Eigen::MatrixXd::Index>(local_x_data.size());
+
+    auto const local_x =
+        MathLib::toVector<Eigen::VectorXd>(local_x_data, num_r_c);
+    auto const local_xdot =
+        MathLib::toVector<Eigen::VectorXd>(local_xdot_data, num_r_c);
+
+    _local_x_perturbed_data = local_x_data;
+    // The Jacobian is accumulated column by column in column-major storage,
+    // which makes the updates of each column contiguous in memory.
+    _local_Jac.setZero(num_r_c, num_r_c);
+
+    // Assemble with unperturbed local x first. The result is the reference
+    // for all differences; it is recomputed after the loop, see below.
+    local_assembler.assemble(t, local_x_data, local_M_data, local_K_data,
+                             local_b_data);
+
+    auto const num_dofs_per_component =
+        local_x_data.size() / _absolute_epsilons.size();
+
+    // See CentralDifferencesJacobianAssembler for the terms of the Jacobian.
+    for (Eigen::MatrixXd::Index i = 0; i < num_r_c; ++i)
+    {
+        // assume that local_x_data is ordered by component.
+        auto const component = i / num_dofs_per_component;
+        auto const eps = _absolute_epsilons[component];
+
+        _local_x_perturbed_data[i] += eps;
+        local_assembler.assemble(t, _local_x_perturbed_data, _local_M_data,
+                                 _local_K_data, _local_b_data);
+
+        _local_x_perturbed_data[i] = local_x_data[i];
+
+        detail::addFiniteDifferencesJacobianColumn(
+            _local_M_data, _local_K_data, _local_b_data, local_M_data,
+            local_K_data, local_b_data, local_x, local_xdot, 1.0 / eps,
+            _local_Jac.col(i));
+
+        _local_M_data.clear();
+        _local_K_data.clear();
+        _local_b_data.clear();
+    }
+
+    auto local_Jac = MathLib::createZeroedMatrix(local_Jac_data,
+                                                 num_r_c, num_r_c);
+    local_Jac = _local_Jac;
+
+    // Assemble with unperturbed local x again, such that the last assembly,
+    // which determines the state of the local assembler (e.g. secondary
+    // variables at the integration points), happens at the actual solution.
+    local_M_data.clear();
+    local_K_data.clear();
+    local_b_data.clear();
+    local_assembler.assemble(t, local_x_data, local_M_data, local_K_data,
+                             local_b_data);
+
+    // Compute remaining terms of the Jacobian.
+    if (dxdot_dx != 0.0 && !local_M_data.empty()) {
+        auto local_M = MathLib::toMatrix(local_M_data, num_r_c, num_r_c);
+        local_Jac.noalias() += local_M * dxdot_dx;
+    }
+    if (dx_dx != 0.0 && !local_K_data.empty()) {
+        auto local_K = MathLib::toMatrix(local_K_data, num_r_c, num_r_c);
+        local_Jac.noalias() += local_K * dx_dx;
+    }
+}
+
+std::unique_ptr<ForwardDifferencesJacobianAssembler>
+createForwardDifferencesJacobianAssembler(BaseLib::ConfigTree const& config)
+{
+    //! \ogs_file_param{prj__processes__process__jacobian_assembler__type}
+    config.checkConfigParameter("type", "ForwardDifferences");
+
+    //! \ogs_file_param_special{prj__processes__process__jacobian_assembler__ForwardDifferences__relative_epsilons}
+    //! \ogs_file_param_special{prj__processes__process__jacobian_assembler__ForwardDifferences__component_magnitudes}
+    auto abs_eps = detail::parseAbsoluteEpsilons(config);
+
+    return std::make_unique<ForwardDifferencesJacobianAssembler>(
+        std::move(abs_eps));
+}
+
+}  // namespace ProcessLib
@@ -0,0 +1,78 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <Eigen/Dense>
+
+#include "AbstractJacobianAssembler.h"
+
+namespace BaseLib
+{
+class ConfigTree;
+}  // BaseLib
+
+namespace ProcessLib
+{
+//! Assembles the Jacobian matrix using one-sided (forward) differences.
+//!
+//! Compared to the CentralDifferencesJacobianAssembler only about half of the
+//! local assemblies are needed, at the price of a first order accurate
+//! approximation of the Jacobian.
+class ForwardDifferencesJacobianAssembler final
+    : public AbstractJacobianAssembler
+{
+public:
+    //! Constructs a new instance.
+    //!
+    //! \param absolute_epsilons perturbations of the components of the local
+    //! solution vector used for evaluating the finite differences.
+    //!
+    //! \note The same restrictions as for the
+    //! CentralDifferencesJacobianAssembler apply for \c absolute_epsilons.
+    explicit ForwardDifferencesJacobianAssembler(
+        std::vector<double>&& absolute_epsilons);
+
+    //! Assembles the Jacobian, the matrices \f$M\f$ and \f$K\f$, and the vector
+    //! \f$b\f$.
+    //! For the assembly the assemble() method of the given \c local_assembler
+    //! is called several times and the Jacobian is built from finite
+    //! differences.
+    //! The number of calls of the assemble() method is \f$N+2\f$ if \f$N\f$ is
+    //! the size of \c local_x. The first and the last call use the
+    //! unperturbed \c local_x, the latter such that the local assembler's
+    //! state corresponds to the actual solution afterwards.
+    //!
+    //! \attention It is assumed that the local vectors and matrices are ordered
+    //! by component.
+    void assembleWithJacobian(
+        LocalAssemblerInterface& local_assembler, double const t,
+        std::vector<double> const& local_x,
+        std::vector<double> const& local_xdot, const double dxdot_dx,
+        const double dx_dx, std::vector<double>& local_M_data,
+        std::vector<double>& local_K_data, std::vector<double>& local_b_data,
+        std::vector<double>& local_Jac_data) override;
+
+private:
+    std::vector<double> const _absolute_epsilons;
+
+    // temporary data only stored here in order to avoid frequent memory
+    // reallocations.
+    std::vector<double> _local_M_data;
+    std::vector<double> _local_K_data;
+    std::vector<double> _local_b_data;
+    std::vector<double> _local_x_perturbed_data;
+    Eigen::MatrixXd _local_Jac;
+};
+
+std::unique_ptr<ForwardDifferencesJacobianAssembler>
+createForwardDifferencesJacobianAssembler(BaseLib::ConfigTree const& config);
+
+}  // namespace ProcessLib
@@ -60,7 +60,16 @@ std::unique_ptr<Process> createGroundwaterFlowProcess(
     DBUG("Use '%s' as hydraulic conductivity parameter.",
          hydraulic_conductivity.name.c_str());
 
-    GroundwaterFlowProcessData process_data{hydraulic_conductivity};
+    auto const batched_assembly =
+        //! \ogs_file_param{prj__processes__process__GROUNDWATER_FLOW__batched_assembly}
+        config.getConfigParameter<bool>("batched_assembly", false);
+
+    auto const matrix_free =
+        //! \ogs_file_param{prj__processes__process__GROUNDWATER_FLOW__matrix_free}
+        config.getConfigParameter<bool>("matrix_free", false);
+
+    GroundwaterFlowProcessData process_data{hydraulic_conductivity,
+                                            batched_assembly, matrix_free};
 
     SecondaryVariableCollection secondary_variables;
 
@@ -0,0 +1,385 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "GroundwaterFlowProcessData.h"
+#include "HydraulicConductivity.h"
+#include "MathLib/LinAlg/GlobalMatrixVectorTypes.h"
+#include "NumLib/DOF/DOFTableUtil.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "ParameterLib/Parameter.h"
+#include "ParameterLib/SpatialPosition.h"
+
+namespace ProcessLib
+{
+namespace GroundwaterFlow
+{
+/// Assembles or applies the conductance matrices of a group of elements of the
+/// same type at once.
+class LocalAssemblerBatchInterface
+{
+public:
+    virtual ~LocalAssemblerBatchInterface() = default;
+
+    virtual void assemble(double const t, GlobalMatrix& K) = 0;
+
+    /// Evaluates the hydraulic conductivities used by apply() and
+    /// addDiagonal().
+    virtual void updateHydraulicConductivities(double const t) = 0;
+
+    /// Computes \f$ y = y + K x \f$ without assembling \f$ K \f$. The vector
+    /// \c x must be locally accessible.
+    virtual void apply(GlobalVector const& x, GlobalVector& y) const = 0;
+
+    /// Adds the diagonal of \f$ K \f$ to \c d.
+    virtual void addDiagonal(GlobalVector& d) const = 0;
+};
+
+/// Batched version of the conductance matrix assembly of LocalAssemblerData.
+///
+/// The shape function gradients and integration weights of up to #batch_size
+/// elements are stored in structure-of-arrays layout with the element index
+/// (lane) running fastest. The integration point loop is then executed once
+/// for the whole batch and the innermost loops over the lanes are contiguous
+/// and independent, which lets the compiler vectorize them.
+/// Unused lanes have zero weights and contribute nothing.
+/// The global indices of the elements' nodes are stored in the same layout,
+/// so that the global vectors are read and updated without temporaries.
+template <typename ShapeFunction, typename IntegrationMethod,
+          unsigned GlobalDim>
+class LocalAssemblerBatch final : public LocalAssemblerBatchInterface
+{
+    static constexpr unsigned n_nodes = ShapeFunction::NPOINTS;
+
+public:
+    static constexpr std::size_t batch_size = 8;
+
+    LocalAssemblerBatch(GroundwaterFlowProcessData const& process_data,
+                        unsigned const n_integration_points)
+        : _process_data(process_data),
+          _n_integration_points(n_integration_points),
+          _dNdx(n_integration_points * GlobalDim * n_nodes * batch_size),
+          _weights(n_integration_points * batch_size),
+          _k(n_integration_points * GlobalDim * GlobalDim * batch_size),
+          _local_K(n_nodes * n_nodes * batch_size)
+    {
+    }
+
+    /// Copies the integration point data and the global indices of the
+    /// element into the next free lane. Returns false if the batch is already
+    /// full.
+    template <typename ShapeMatricesVector>
+    bool add(std::size_t const element_id,
+             NumLib::LocalToGlobalIndexMap const& dof_table,
+             ShapeMatricesVector const& shape_matrices,
+             IntegrationMethod const& integration_method)
+    {
+        if (_n_elements == batch_size)
+        {
+            return false;
+        }
+        assert(shape_matrices.size() == _n_integration_points);
+
+        auto const lane = _n_elements;
+        for (unsigned ip = 0; ip < _n_integration_points; ip++)
+        {
+            auto const& sm = shape_matrices[ip];
+            _weights[ip * batch_size + lane] =
+                sm.detJ * sm.integralMeasure *
+                integration_method.getWeightedPoint(ip).getWeight();
+            for (unsigned d = 0; d < GlobalDim; d++)
+            {
+                for (unsigned a = 0; a < n_nodes; a++)
+                {
+                    _dNdx[dNdxIndex(ip, d, a) + lane] = sm.dNdx(d, a);
+                }
+            }
+        }
+
+        auto const indices = NumLib::getIndices(element_id, dof_table);
+        assert(indices.size() == n_nodes);
+        for (unsigned a = 0; a < n_nodes; a++)
+        {
+            _indices[a * batch_size + lane] = indices[a];
+        }
+
+        _element_ids[lane] = element_id;
+        _n_elements++;
+        return true;
+    }
+
+    void assemble(double const t, GlobalMatrix& K) override
+    {
+        updateHydraulicConductivities(t);
+
+        std::fill(_local_K.begin(), _local_K.end(), 0.0);
+
+        // Gradients of the shape functions weighted with k and the
+        // integration weight for one integration point.
+        std::array<double, GlobalDim * n_nodes * batch_size> q;
+
+        for (unsigned ip = 0; ip < _n_integration_points; ip++)
+        {
+            double const* const w = &_weights[ip * batch_size];
+            for (unsigned d = 0; d < GlobalDim; d++)
+            {
+                for (unsigned b = 0; b < n_nodes; b++)
+                {
+                    double* const q_db = &q[(d * n_nodes + b) * batch_size];
+#pragma omp simd
+                    for (std::size_t l = 0; l < batch_size; l++)
+                    {
+                        q_db[l] = 0;
+                    }
+                    for (unsigned e = 0; e < GlobalDim; e++)
+                    {
+                        double const* const k_de = &_k[kIndex(ip, d, e)];
+                        double const* const dNdx_eb =
+                            &_dNdx[dNdxIndex(ip, e, b)];
+#pragma omp simd
+                        for (std::size_t l = 0; l < batch_size; l++)
+                        {
+                            q_db[l] += k_de[l] * dNdx_eb[l] * w[l];
+                        }
+                    }
+                }
+            }
+
+            for (unsigned a = 0; a < n_nodes; a++)
+            {
+                for (unsigned d = 0; d < GlobalDim; d++)
+                {
+                    double const* const dNdx_da = &_dNdx[dNdxIndex(ip, d, a)];
+                    for (unsigned b = 0; b < n_nodes; b++)
+                    {
+                        double const* const q_db =
+                            &q[(d * n_nodes + b) * batch_size];
+                        double* const K_ab =
+                            &_local_K[(a * n_nodes + b) * batch_size];
+#pragma omp simd
+                        for (std::size_t l = 0; l < batch_size; l++)
+                        {
+                            K_ab[l] += dNdx_da[l] * q_db[l];
+                        }
+                    }
+                }
+            }
+        }
+
+        Eigen::Matrix<double, n_nodes, n_nodes, Eigen::RowMajor> local_K;
+        std::vector<GlobalIndexType> indices(n_nodes);
+        for (std::size_t l = 0; l < _n_elements; l++)
+        {
+            for (unsigned a = 0; a < n_nodes; a++)
+            {
+                indices[a] = _indices[a * batch_size + l];
+                for (unsigned b = 0; b < n_nodes; b++)
+                {
+                    local_K(a, b) =
+                        _local_K[(a * n_nodes + b) * batch_size + l];
+                }
+            }
+
+            K.add(NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices,
+                                                                  indices),
+                  local_K);
+        }
+    }
+
+    void updateHydraulicConductivities(double const t) override
+    {
+        ParameterLib::SpatialPosition pos;
+        for (std::size_t l = 0; l < _n_elements; l++)
+        {
+            pos.setElementID(_element_ids[l]);
+            for (unsigned ip = 0; ip < _n_integration_points; ip++)
+            {
+                pos.setIntegrationPoint(ip);
+                auto const k = hydraulicConductivity<GlobalDim>(
+                    _process_data.hydraulic_conductivity(t, pos));
+                for (unsigned d = 0; d < GlobalDim; d++)
+                {
+                    for (unsigned e = 0; e < GlobalDim; e++)
+                    {
+                        _k[kIndex(ip, d, e) + l] = k(d, e);
+                    }
+                }
+            }
+        }
+    }
+
+    /// Computes the local products \f$ K_e x_e \f$ integration point by
+    /// integration point, i.e., as \f$ \sum_{ip} B^T (w k) (B x_e) \f$ with
+    /// the shape function gradients \f$ B \f$, without forming \f$ K_e \f$.
+    void apply(GlobalVector const& x, GlobalVector& y) const override
+    {
+        std::array<double, n_nodes * batch_size> x_e{};
+        for (unsigned a = 0; a < n_nodes; a++)
+        {
+            auto const i = a * batch_size;
+            for (std::size_t l = 0; l < _n_elements; l++)
+            {
+                x_e[i + l] = x.get(_indices[i + l]);
+            }
+        }
+
+        std::array<double, n_nodes * batch_size> y_e{};
+        // Pressure gradient and weighted flux at one integration point.
+        std::array<double, GlobalDim * batch_size> g;
+        std::array<double, GlobalDim * batch_size> q;
+
+        for (unsigned ip = 0; ip < _n_integration_points; ip++)
+        {
+            double const* const w = &_weights[ip * batch_size];
+            for (unsigned d = 0; d < GlobalDim; d++)
+            {
+                double* const g_d = &g[d * batch_size];
+#pragma omp simd
+                for (std::size_t l = 0; l < batch_size; l++)
+                {
+                    g_d[l] = 0;
+                }
+                for (unsigned a = 0; a < n_nodes; a++)
+                {
+                    double const* const dNdx_da = &_dNdx[dNdxIndex(ip, d, a)];
+                    double const* const x_a = &x_e[a * batch_size];
+#pragma omp simd
+                    for (std::size_t l = 0; l < batch_size; l++)
+                    {
+                        g_d[l] += dNdx_da[l] * x_a[l];
+                    }
+                }
+            }
+
+            for (unsigned d = 0; d < GlobalDim; d++)
+            {
+                double* const q_d = &q[d * batch_size];
+#pragma omp simd
+                for (std::size_t l = 0; l < batch_size; l++)
+                {
+                    q_d[l] = 0;
+                }
+                for (unsigned e = 0; e < GlobalDim; e++)
+                {
+                    double const* const k_de = &_k[kIndex(ip, d, e)];
+                    double const* const g_e = &g[e * batch_size];
+#pragma omp simd
+                    for (std::size_t l = 0; l < batch_size; l++)
+                    {
+                        q_d[l] += w[l] * k_de[l] * g_e[l];
+                    }
+                }
+            }
+
+            for (unsigned a = 0; a < n_nodes; a++)
+            {
+                double* const y_a = &y_e[a * batch_size];
+                for (unsigned d = 0; d < GlobalDim; d++)
+                {
+                    double const* const dNdx_da = &_dNdx[dNdxIndex(ip, d, a)];
+                    double const* const q_d = &q[d * batch_size];
+#pragma omp simd
+                    for (std::size_t l = 0; l < batch_size; l++)
+                    {
+                        y_a[l] += dNdx_da[l] * q_d[l];
+                    }
+                }
+            }
+        }
+
+        for (unsigned a = 0; a < n_nodes; a++)
+        {
+            auto const i = a * batch_size;
+            for (std::size_t l = 0; l < _n_elements; l++)
+            {
+                y.add(_indices[i + l], y_e[i + l]);
+            }
+        }
+    }
+
+    void addDiagonal(GlobalVector& d) const override
+    {
+        std::array<double, n_nodes * batch_size> diagonal{};
+
+        for (unsigned ip = 0; ip < _n_integration_points; ip++)
+        {
+            double const* const w = &_weights[ip * batch_size];
+            for (unsigned a = 0; a < n_nodes; a++)
+            {
+                double* const K_aa = &diagonal[a * batch_size];
+                for (unsigned i = 0; i < GlobalDim; i++)
+                {
+                    double const* const dNdx_ia = &_dNdx[dNdxIndex(ip, i, a)];
+                    for (unsigned j = 0; j < GlobalDim; j++)
+                    {
+                        double const* const k_ij = &_k[kIndex(ip, i, j)];
+                        double const* const dNdx_ja =
+                            &_dNdx[dNdxIndex(ip, j, a)];
+#pragma omp simd
+                        for (std::size_t l = 0; l < batch_size; l++)
+                        {
+                            K_aa[l] += w[l] * dNdx_ia[l] * k_ij[l] * dNdx_ja[l];
+                        }
+                    }
+                }
+            }
+        }
+
+        for (unsigned a = 0; a < n_nodes; a++)
+        {
+            auto const i = a * batch_size;
+            for (std::size_t l = 0; l < _n_elements; l++)
+            {
+                d.add(_indices[i + l], diagonal[i + l]);
+            }
+        }
+    }
+
+private:
+    std::size_t dNdxIndex(unsigned const ip, unsigned const d,
+                          unsigned const a) const
+    {
+        return ((ip * GlobalDim + d) * n_nodes + a) * batch_size;
+    }
+
+    std::size_t kIndex(unsigned const ip, unsigned const d,
+                       unsigned const e) const
+    {
+        return ((ip * GlobalDim + d) * GlobalDim + e) * batch_size;
+    }
+
+    GroundwaterFlowProcessData const& _process_data;
+    unsigned const _n_integration_points;
+
+    /// Shape function gradients, indexed [ip][d][node][lane].
+    std::vector<double> _dNdx;
+    /// detJ * integralMeasure * weight, indexed [ip][lane].
+    std::vector<double> _weights;
+    /// Hydraulic conductivity tensors, indexed [ip][d][e][lane].
+    std::vector<double> _k;
+    /// Local conductance matrices, indexed [a][b][lane].
+    std::vector<double> _local_K;
+
+    /// Global indices of the nodes, indexed [node][lane].
+    std::array<GlobalIndexType, n_nodes * batch_size> _indices{};
+
+    std::array<std::size_t, batch_size> _element_ids{};
+    std::size_t _n_elements = 0;
+};
+
+}  // namespace GroundwaterFlow
+}  // namespace ProcessLib
@@ -9,9 +9,12 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
+#include "GroundwaterFlowBatchedFEM.h"
 #include "GroundwaterFlowProcessData.h"
+#include "HydraulicConductivity.h"
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
 #include "NumLib/DOF/DOFTableUtil.h"
 #include "NumLib/Extrapolation/ExtrapolatableElement.h"
@@ -28,34 +31,6 @@ namespace GroundwaterFlow
 {
 const unsigned NUM_NODAL_DOF = 1;
 
-template <int GlobalDim>
-Eigen::Matrix<double, GlobalDim, GlobalDim> hydraulicConductivity(
-    std::vector<double> const& values)
-{
-    auto const size{values.size()};
-    if (size == 1)  // This is a duplicate but preferred case for GlobalDim==1.
-    {
-        return Eigen::Matrix<double, GlobalDim, GlobalDim>::Identity() *
-               values[0];
-    }
-    if (size == GlobalDim)
-    {
-        return Eigen::Map<Eigen::Matrix<double, GlobalDim, 1> const>(
-                   values.data(), GlobalDim, 1)
-            .asDiagonal();
-    }
-    if (size == GlobalDim * GlobalDim)
-    {
-        return Eigen::Map<Eigen::Matrix<double, GlobalDim, GlobalDim> const>(
-            values.data(), GlobalDim, GlobalDim);
-    }
-
-    OGS_FATAL(
-        "Hydraulic conductivity parameter values size is neither one nor %d "
-        "nor %d squared, but %d.",
-        GlobalDim, GlobalDim, values.size());
-}
-
 class GroundwaterFlowLocalAssemblerInterface
     : public ProcessLib::LocalAssemblerInterface,
       public NumLib::ExtrapolatableElement
@@ -66,6 +41,17 @@ public:
         GlobalVector const& /*current_solution*/,
         NumLib::LocalToGlobalIndexMap const& /*dof_table*/,
         std::vector<double>& /*cache*/) const = 0;
+
+    /// Creates an empty batch that elements of the same type as this one can
+    /// be added to.
+    virtual std::unique_ptr<LocalAssemblerBatchInterface> createBatch()
+        const = 0;
+
+    /// Adds this element to the given batch, which must have been created by
+    /// a local assembler of the same type. Returns false if the batch is full.
+    virtual bool addToBatch(
+        LocalAssemblerBatchInterface& batch,
+        NumLib::LocalToGlobalIndexMap const& dof_table) const = 0;
 };
 
 template <typename ShapeFunction, typename IntegrationMethod,
@@ -207,6 +193,23 @@ public:
         return cache;
     }
 
+    std::unique_ptr<LocalAssemblerBatchInterface> createBatch() const override
+    {
+        return std::make_unique<LocalAssemblerBatch<
+            ShapeFunction, IntegrationMethod, GlobalDim>>(
+            _process_data, _integration_method.getNumberOfPoints());
+    }
+
+    bool addToBatch(
+        LocalAssemblerBatchInterface& batch,
+        NumLib::LocalToGlobalIndexMap const& dof_table) const override
+    {
+        return static_cast<LocalAssemblerBatch<ShapeFunction, IntegrationMethod,
+                                               GlobalDim>&>(batch)
+            .add(_element.getID(), dof_table, _shape_matrices,
+                 _integration_method);
+    }
+
 private:
     MeshLib::Element const& _element;
     GroundwaterFlowProcessData const& _process_data;
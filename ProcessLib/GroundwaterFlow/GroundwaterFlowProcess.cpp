@@ -10,6 +10,9 @@
 #include "GroundwaterFlowProcess.h"
 
 #include <cassert>
+#include <numeric>
+#include <typeindex>
+#include <unordered_map>
 
 #include "ProcessLib/Utils/CreateLocalAssemblers.h"
 
@@ -54,6 +57,85 @@ void GroundwaterFlowProcess::initializeConcreteProcess(
         makeExtrapolator(
             mesh.getDimension(), getExtrapolator(), _local_assemblers,
             &GroundwaterFlowLocalAssemblerInterface::getIntPtDarcyVelocity));
+
+    if (_process_data.batched_assembly || _process_data.matrix_free)
+    {
+        createLocalAssemblerBatches(pv.getActiveElementIDs());
+    }
+
+    if (_process_data.matrix_free)
+    {
+        _matrix_free_operator = std::make_unique<MatrixFreeConductanceOperator>(
+            _local_assembler_batches);
+        // The global matrices only hold boundary condition contributions.
+        GlobalSparsityPattern().swap(_sparsity_pattern);
+    }
+}
+
+MathLib::MatrixSpecifications GroundwaterFlowProcess::getMatrixSpecifications(
+    const int process_id) const
+{
+    auto const specifications = Process::getMatrixSpecifications(process_id);
+    if (!_process_data.matrix_free)
+    {
+        return specifications;
+    }
+    // No preallocation of the mostly empty matrices.
+    return {specifications.nrows, specifications.ncols,
+            specifications.ghost_indices, nullptr,
+            specifications.field_splits};
+}
+
+MathLib::MatrixFreeOperator<GlobalVector> const*
+GroundwaterFlowProcess::getMatrixFreeOperator(int const /*process_id*/) const
+{
+    return _matrix_free_operator.get();
+}
+
+void GroundwaterFlowProcess::createLocalAssemblerBatches(
+    std::vector<std::size_t> const& active_element_ids)
+{
+    _local_assembler_batches.clear();
+    _batched_element_ids = active_element_ids;
+
+    std::vector<std::size_t> element_ids = active_element_ids;
+    if (element_ids.empty())
+    {
+        element_ids.resize(_local_assemblers.size());
+        std::iota(element_ids.begin(), element_ids.end(), 0);
+    }
+
+    // The batch currently being filled for each local assembler type.
+    std::unordered_map<std::type_index, LocalAssemblerBatchInterface*>
+        open_batches;
+    for (auto const element_id : element_ids)
+    {
+        auto const& local_assembler = *_local_assemblers[element_id];
+        auto& batch = open_batches[std::type_index(typeid(local_assembler))];
+        if (batch != nullptr &&
+            local_assembler.addToBatch(*batch, *_local_to_global_index_map))
+        {
+            continue;
+        }
+        _local_assembler_batches.push_back(local_assembler.createBatch());
+        batch = _local_assembler_batches.back().get();
+        local_assembler.addToBatch(*batch, *_local_to_global_index_map);
+    }
+
+    DBUG("Grouped %d elements into %d local assembler batches.",
+         element_ids.size(), _local_assembler_batches.size());
+}
+
+void GroundwaterFlowProcess::updateLocalAssemblerBatches()
+{
+    const int process_id = 0;
+    ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
+    // The active elements change with the time intervals of the deactivated
+    // subdomains.
+    if (pv.getActiveElementIDs() != _batched_element_ids)
+    {
+        createLocalAssemblerBatches(pv.getActiveElementIDs());
+    }
 }
 
 void GroundwaterFlowProcess::assembleConcreteProcess(const double t,
@@ -64,6 +146,43 @@ void GroundwaterFlowProcess::assembleConcreteProcess(const double t,
 {
     DBUG("Assemble GroundwaterFlowProcess.");
 
+    if (_matrix_free_operator)
+    {
+        if (_coupled_solutions != nullptr)
+        {
+            OGS_FATAL(
+                "The matrix-free GroundwaterFlowProcess can not be used in "
+                "the staggered scheme.");
+        }
+        if (_global_assembler.isRecordingAssemblyCosts())
+        {
+            OGS_FATAL(
+                "The matrix-free GroundwaterFlowProcess does not assemble "
+                "element-wise; the assembly costs can not be recorded.");
+        }
+        // K is applied by _matrix_free_operator, and M and b are zero.
+        updateLocalAssemblerBatches();
+        for (auto& batch : _local_assembler_batches)
+        {
+            batch->updateHydraulicConductivities(t);
+        }
+        return;
+    }
+
+    // The conductance matrix does not depend on x, and M and b are zero.
+    // The batches are not timed per element, hence the element-wise assembly
+    // is used while the assembly costs are recorded.
+    if (!_local_assembler_batches.empty() && _coupled_solutions == nullptr &&
+        !_global_assembler.isRecordingAssemblyCosts())
+    {
+        updateLocalAssemblerBatches();
+        for (auto& batch : _local_assembler_batches)
+        {
+            batch->assemble(t, K);
+        }
+        return;
+    }
+
     const int process_id = 0;
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
@@ -82,6 +201,13 @@ void GroundwaterFlowProcess::assembleWithJacobianConcreteProcess(
 {
     DBUG("AssembleWithJacobian GroundwaterFlowProcess.");
 
+    if (_matrix_free_operator)
+    {
+        OGS_FATAL(
+            "The matrix-free GroundwaterFlowProcess can only be used with the "
+            "Picard nonlinear solver.");
+    }
+
     const int process_id = 0;
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
@@ -13,6 +13,7 @@
 #include "ProcessLib/Process.h"
 #include "GroundwaterFlowFEM.h"
 #include "GroundwaterFlowProcessData.h"
+#include "MatrixFreeConductanceOperator.h"
 #include "ProcessLib/SurfaceFlux/SurfaceFluxData.h"
 
 // TODO used for output, if output classes are ready this has to be changed
@@ -44,6 +45,12 @@ public:
     //! @{
 
     bool isLinear() const override { return true; }
+
+    MathLib::MatrixSpecifications getMatrixSpecifications(
+        const int process_id) const override;
+
+    MathLib::MatrixFreeOperator<GlobalVector> const* getMatrixFreeOperator(
+        int const process_id) const override;
     //! @}
 
     Eigen::Vector3d getFlux(std::size_t element_id,
@@ -89,6 +96,15 @@ private:
         MeshLib::Mesh const& mesh,
         unsigned const integration_order) override;
 
+    /// Groups the local assemblers of the given elements into batches of
+    /// elements of the same type. An empty list selects all elements.
+    void createLocalAssemblerBatches(
+        std::vector<std::size_t> const& active_element_ids);
+
+    /// Regroups the batches if the active elements of the process variable
+    /// differ from the ones the batches were created for.
+    void updateLocalAssemblerBatches();
+
     void assembleConcreteProcess(const double t, GlobalVector const& x,
                                  GlobalMatrix& M, GlobalMatrix& K,
                                  GlobalVector& b) override;
@@ -103,6 +119,15 @@ private:
     std::vector<std::unique_ptr<GroundwaterFlowLocalAssemblerInterface>>
         _local_assemblers;
 
+    std::vector<std::unique_ptr<LocalAssemblerBatchInterface>>
+        _local_assembler_batches;
+    /// The active element ids the batches were created for; empty if all
+    /// elements are active.
+    std::vector<std::size_t> _batched_element_ids;
+
+    /// Set if the conductance matrix is not assembled.
+    std::unique_ptr<MatrixFreeConductanceOperator> _matrix_free_operator;
+
     std::unique_ptr<ProcessLib::SurfaceFluxData> _surfaceflux;
 };
 
@@ -19,13 +19,18 @@ namespace GroundwaterFlow
 {
 struct GroundwaterFlowProcessData final
 {
-    explicit GroundwaterFlowProcessData(
-        ParameterLib::Parameter<double> const& hydraulic_conductivity_)
-        : hydraulic_conductivity(hydraulic_conductivity_)
+    GroundwaterFlowProcessData(
+        ParameterLib::Parameter<double> const& hydraulic_conductivity_,
+        bool const batched_assembly_, bool const matrix_free_)
+        : hydraulic_conductivity(hydraulic_conductivity_),
+          batched_assembly(batched_assembly_),
+          matrix_free(matrix_free_)
     {}
 
     GroundwaterFlowProcessData(GroundwaterFlowProcessData&& other)
-        : hydraulic_conductivity(other.hydraulic_conductivity)
+        : hydraulic_conductivity(other.hydraulic_conductivity),
+          batched_assembly(other.batched_assembly),
+          matrix_free(other.matrix_free)
     {}
 
     //! Copies are forbidden.
@@ -38,6 +43,14 @@ struct GroundwaterFlowProcessData final
     void operator=(GroundwaterFlowProcessData&&) = delete;
 
     ParameterLib::Parameter<double> const& hydraulic_conductivity;
+
+    /// Assemble the conductance matrix in batches of elements of the same
+    /// type, see LocalAssemblerBatch.
+    bool const batched_assembly;
+
+    /// Apply the conductance matrix element-wise in the linear solver instead
+    /// of assembling it, see MatrixFreeConductanceOperator.
+    bool const matrix_free;
 };
 
 } // namespace GroundwaterFlow
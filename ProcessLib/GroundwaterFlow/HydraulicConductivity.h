@@ -0,0 +1,51 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "BaseLib/Error.h"
+
+namespace ProcessLib
+{
+namespace GroundwaterFlow
+{
+template <int GlobalDim>
+Eigen::Matrix<double, GlobalDim, GlobalDim> hydraulicConductivity(
+    std::vector<double> const& values)
+{
+    auto const size{values.size()};
+    if (size == 1)  // This is a duplicate but preferred case for GlobalDim==1.
+    {
+        return Eigen::Matrix<double, GlobalDim, GlobalDim>::Identity() *
+               values[0];
+    }
+    if (size == GlobalDim)
+    {
+        return Eigen::Map<Eigen::Matrix<double, GlobalDim, 1> const>(
+                   values.data(), GlobalDim, 1)
+            .asDiagonal();
+    }
+    if (size == GlobalDim * GlobalDim)
+    {
+        return Eigen::Map<Eigen::Matrix<double, GlobalDim, GlobalDim> const>(
+            values.data(), GlobalDim, GlobalDim);
+    }
+
+    OGS_FATAL(
+        "Hydraulic conductivity parameter values size is neither one nor %d "
+        "nor %d squared, but %d.",
+        GlobalDim, GlobalDim, values.size());
+}
+
+}  // namespace GroundwaterFlow
+}  // namespace ProcessLib
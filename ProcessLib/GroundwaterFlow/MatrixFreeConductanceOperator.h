@@ -0,0 +1,64 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "GroundwaterFlowBatchedFEM.h"
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/MatrixFreeOperator.h"
+
+namespace ProcessLib
+{
+namespace GroundwaterFlow
+{
+/// The global conductance matrix applied batch by batch without assembling it.
+/// The batches are owned by the process, which may regroup them when the set
+/// of active elements changes.
+class MatrixFreeConductanceOperator final
+    : public MathLib::MatrixFreeOperator<GlobalVector>
+{
+public:
+    explicit MatrixFreeConductanceOperator(
+        std::vector<std::unique_ptr<LocalAssemblerBatchInterface>> const&
+            batches)
+        : _batches(batches)
+    {
+    }
+
+    void apply(GlobalVector const& x, GlobalVector& y) const override
+    {
+        MathLib::LinAlg::set(y, 0.0);
+        MathLib::LinAlg::setLocalAccessibleVector(x);
+        for (auto const& batch : _batches)
+        {
+            batch->apply(x, y);
+        }
+        MathLib::LinAlg::finalizeAssembly(y);
+    }
+
+    void getDiagonal(GlobalVector& d) const override
+    {
+        MathLib::LinAlg::set(d, 0.0);
+        for (auto const& batch : _batches)
+        {
+            batch->addDiagonal(d);
+        }
+        MathLib::LinAlg::finalizeAssembly(d);
+    }
+
+private:
+    std::vector<std::unique_ptr<LocalAssemblerBatchInterface>> const&
+        _batches;
+};
+
+}  // namespace GroundwaterFlow
+}  // namespace ProcessLib
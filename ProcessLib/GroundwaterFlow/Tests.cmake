@@ -391,6 +391,20 @@ AddTest(
     cube_1e3_pcs_0_ts_1_t_1_000000_2.vtu cube_1e3_pcs_0_ts_1_t_1_000000_2.vtu Linear_1_to_minus1 pressure 2e-15 1e-16
 )
 
+AddTest(
+    NAME ParallelFEM_GroundWaterFlow3D_DirichletBC_matrix_free
+    PATH EllipticPETSc
+    EXECUTABLE_ARGS cube_1e3_matrix_free.prj
+    WRAPPER mpirun
+    WRAPPER_ARGS -np 3
+    TESTER vtkdiff
+    REQUIREMENTS OGS_USE_MPI
+    DIFF_DATA
+    cube_1e3_pcs_0_ts_1_t_1_000000_0.vtu cube_1e3_matrix_free_pcs_0_ts_1_t_1_000000_0.vtu Linear_1_to_minus1 pressure 1e-10 0
+    cube_1e3_pcs_0_ts_1_t_1_000000_1.vtu cube_1e3_matrix_free_pcs_0_ts_1_t_1_000000_1.vtu Linear_1_to_minus1 pressure 1e-10 0
+    cube_1e3_pcs_0_ts_1_t_1_000000_2.vtu cube_1e3_matrix_free_pcs_0_ts_1_t_1_000000_2.vtu Linear_1_to_minus1 pressure 1e-10 0
+)
+
 AddTest(
     NAME ParallelFEM_GroundWaterFlow3D_NeumannBC
     PATH EllipticPETSc
@@ -761,3 +775,27 @@ AddTest(
 if (NOT OGS_USE_MPI)
     OgsTest(PROJECTFILE "Elliptic/cube_1x1x1_GroundWaterFlow/cube_1e4_anisotropic.prj")
 endif() # OGS_USE_MPI
+
+AddTest(
+    NAME GroundWaterFlowProcess_cube_1e4_anisotropic_batched
+    PATH Elliptic/cube_1x1x1_GroundWaterFlow
+    EXECUTABLE ogs
+    EXECUTABLE_ARGS cube_1e4_anisotropic_batched.prj
+    TESTER vtkdiff
+    REQUIREMENTS NOT OGS_USE_MPI
+    DIFF_DATA
+    cube_1e4_anisotropic_pcs_0_ts_1_t_1.000000.vtu cube_1e4_anisotropic_batched_pcs_0_ts_1_t_1.000000.vtu pressure pressure 1e-13 0
+    cube_1e4_anisotropic_pcs_0_ts_1_t_1.000000.vtu cube_1e4_anisotropic_batched_pcs_0_ts_1_t_1.000000.vtu darcy_velocity darcy_velocity 1e-12 0
+)
+
+AddTest(
+    NAME GroundWaterFlowProcess_cube_1e4_anisotropic_matrix_free
+    PATH Elliptic/cube_1x1x1_GroundWaterFlow
+    EXECUTABLE ogs
+    EXECUTABLE_ARGS cube_1e4_anisotropic_matrix_free.prj
+    TESTER vtkdiff
+    REQUIREMENTS NOT (OGS_USE_LIS OR OGS_USE_MPI)
+    DIFF_DATA
+    cube_1e4_anisotropic_pcs_0_ts_1_t_1.000000.vtu cube_1e4_anisotropic_matrix_free_pcs_0_ts_1_t_1.000000.vtu pressure pressure 1e-10 0
+    cube_1e4_anisotropic_pcs_0_ts_1_t_1.000000.vtu cube_1e4_anisotropic_matrix_free_pcs_0_ts_1_t_1.000000.vtu darcy_velocity darcy_velocity 1e-9 0
+)
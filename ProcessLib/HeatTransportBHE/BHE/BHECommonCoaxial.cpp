@@ -44,6 +44,17 @@ double BHECommonCoaxial::updateFlowRateAndTemperature(double const T_out,
     updateHeatTransferCoefficients(values.flow_rate);
     return values.temperature;
 }
+
+InflowTemperatureRelation
+BHECommonCoaxial::updateFlowRateAndInflowTemperatureRelation(
+    double const current_time)
+{
+    auto const relation =
+        getInflowTemperatureRelation(flowAndTemperatureControl, current_time);
+    updateHeatTransferCoefficients(relation.flow_rate);
+    return relation;
+}
+
 std::array<double, BHECommonCoaxial::number_of_unknowns>
 BHECommonCoaxial::pipeHeatConductions() const
 {
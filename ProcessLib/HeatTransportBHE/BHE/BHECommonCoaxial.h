@@ -48,6 +48,9 @@ public:
 
     double updateFlowRateAndTemperature(double T_out, double current_time);
 
+    InflowTemperatureRelation updateFlowRateAndInflowTemperatureRelation(
+        double current_time);
+
     std::array<double, number_of_unknowns> calcThermalResistances(
         double const Nu_inner_pipe, double const Nu_annulus_pipe);
 
@@ -245,6 +245,15 @@ double BHE_1U::updateFlowRateAndTemperature(double const T_out,
     updateHeatTransferCoefficients(values.flow_rate);
     return values.temperature;
 }
+
+InflowTemperatureRelation
+BHE_1U::updateFlowRateAndInflowTemperatureRelation(double const current_time)
+{
+    auto const relation =
+        getInflowTemperatureRelation(flowAndTemperatureControl, current_time);
+    updateHeatTransferCoefficients(relation.flow_rate);
+    return relation;
+}
 }  // namespace BHE
 }  // namespace HeatTransportBHE
 }  // namespace ProcessLib
@@ -127,6 +127,11 @@ public:
     /// Return the inflow temperature for the boundary condition.
     double updateFlowRateAndTemperature(double T_out, double current_time);
 
+    /// Updates the flow rate for the given time and returns the relation
+    /// between the inflow and the outflow temperature.
+    InflowTemperatureRelation updateFlowRateAndInflowTemperatureRelation(
+        double current_time);
+
     double thermalResistance(int const unknown_index) const
     {
         return _thermal_resistances[unknown_index];
@@ -33,6 +33,7 @@ struct TemperatureCurveConstantFlow
     {
         return {flow_rate, temperature_curve.getValue(time)};
     }
+    static constexpr double outflow_temperature_factor = 0;
     double flow_rate;
     MathLib::PiecewiseLinearInterpolation const& temperature_curve;
 };
@@ -44,6 +45,7 @@ struct FixedPowerConstantFlow
     {
         return {flow_rate, power / flow_rate / heat_capacity / density + T_out};
     }
+    static constexpr double outflow_temperature_factor = 1;
     double flow_rate;
     double power;  // Value is expected to be in Watt.
     double heat_capacity;
@@ -57,6 +59,7 @@ struct FixedPowerFlowCurve
         double const flow_rate = flow_curve.getValue(time);
         return {flow_rate, power / flow_rate / heat_capacity / density + T_out};
     }
+    static constexpr double outflow_temperature_factor = 1;
     MathLib::PiecewiseLinearInterpolation const& flow_curve;
 
     double power;  // Value is expected to be in Watt.
@@ -71,6 +74,7 @@ struct PowerCurveConstantFlow
         double const power = power_curve.getValue(time);
         return {flow_rate, power / flow_rate / heat_capacity / density + T_out};
     }
+    static constexpr double outflow_temperature_factor = 1;
     MathLib::PiecewiseLinearInterpolation const& power_curve;
 
     double flow_rate;
@@ -83,6 +87,42 @@ using FlowAndTemperatureControl = boost::variant<TemperatureCurveConstantFlow,
                                                  FixedPowerFlowCurve,
                                                  PowerCurveConstantFlow>;
 
+/// The inflow temperature of all controls is an affine function of the
+/// outflow temperature, \f$ T_{in} = a T_{out} + c \f$, and the flow rate
+/// depends on time only.
+struct InflowTemperatureRelation
+{
+    double const flow_rate;
+    double const outflow_temperature_factor;  ///< a
+    double const temperature_offset;          ///< c
+};
+
+inline InflowTemperatureRelation getInflowTemperatureRelation(
+    FlowAndTemperatureControl const& flow_and_temperature_control,
+    double const time)
+{
+    return apply_visitor(
+        [time](auto const& control) {
+            auto const values = control(0, time);
+            return InflowTemperatureRelation{
+                values.flow_rate, control.outflow_temperature_factor,
+                values.temperature};
+        },
+        flow_and_temperature_control);
+}
+
+/// Returns the factor \f$ a \f$ of the outflow temperature in the inflow
+/// temperature relation, which is zero for prescribed inflow temperatures.
+inline double getOutflowTemperatureFactor(
+    FlowAndTemperatureControl const& flow_and_temperature_control)
+{
+    return apply_visitor(
+        [](auto const& control) {
+            return control.outflow_temperature_factor;
+        },
+        flow_and_temperature_control);
+}
+
 }  // namespace BHE
 }  // namespace HeatTransportBHE
 }  // namespace ProcessLib
@@ -9,6 +9,9 @@
  */
 
 #include "BHEBottomDirichletBoundaryCondition.h"
+
+#include <algorithm>
+
 #include "BaseLib/Error.h"
 
 namespace ProcessLib::HeatTransportBHE
@@ -17,19 +20,24 @@ void BHEBottomDirichletBoundaryCondition::getEssentialBCValues(
     const double /*t*/, GlobalVector const& x,
     NumLib::IndexValueVector<GlobalIndexType>& bc_values) const
 {
-    bc_values.ids.resize(1);
-    bc_values.values.resize(1);
-
-    bc_values.ids[0] = _in_out_global_indices.second;
-    // here, the outflow temperature is always
-    // the same as the inflow temperature
-    // get the inflow temperature from here.
-    bc_values.values[0] = x[_in_out_global_indices.first];
+    auto const n = _in_out_global_indices.size();
+    bc_values.ids.resize(n);
+    bc_values.values.resize(n);
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        bc_values.ids[i] = _in_out_global_indices[i].second;
+        // here, the outflow temperature is always
+        // the same as the inflow temperature
+        // get the inflow temperature from here.
+        bc_values.values[i] = x[_in_out_global_indices[i].first];
+    }
 }
 
 std::unique_ptr<BHEBottomDirichletBoundaryCondition>
 createBHEBottomDirichletBoundaryCondition(
-    std::pair<GlobalIndexType, GlobalIndexType>&& in_out_global_indices)
+    std::vector<std::pair<GlobalIndexType, GlobalIndexType>>&&
+        in_out_global_indices)
 {
     DBUG("Constructing BHEBottomDirichletBoundaryCondition.");
 
@@ -37,20 +45,30 @@ createBHEBottomDirichletBoundaryCondition(
     // boundary condition.
 #ifdef USE_PETSC
     // For this special boundary condition the boundary condition is not empty
-    // if the global indices are non-negative.
-    if (in_out_global_indices.first < 0 && in_out_global_indices.second < 0)
+    // if the global indices are non-negative. BHEs of other partitions are
+    // removed.
+    auto const is_not_local =
+        [](std::pair<GlobalIndexType, GlobalIndexType> const& in_out) {
+            // If only one of the global indices (in or out) is negative the
+            // implementation is not valid.
+            if ((in_out.first < 0) != (in_out.second < 0))
+            {
+                OGS_FATAL(
+                    "The partition cuts the BHE into two independent parts. "
+                    "This behaviour is not implemented.");
+            }
+            return in_out.first < 0;
+        };
+    in_out_global_indices.erase(
+        std::remove_if(in_out_global_indices.begin(),
+                       in_out_global_indices.end(), is_not_local),
+        in_out_global_indices.end());
+#endif  // USE_PETSC
+
+    if (in_out_global_indices.empty())
     {
         return nullptr;
     }
-    // If only one of the global indices (in or out) is negative the
-    // implementation is not valid.
-    if (in_out_global_indices.first < 0 || in_out_global_indices.second < 0)
-    {
-        OGS_FATAL(
-            "The partition cuts the BHE into two independent parts. This "
-            "behaviour is not implemented.");
-    }
-#endif  // USE_PETSC
 
     return std::make_unique<BHEBottomDirichletBoundaryCondition>(
         std::move(in_out_global_indices));
@@ -15,11 +15,17 @@
 
 namespace ProcessLib::HeatTransportBHE
 {
+/// Dirichlet boundary condition setting the outflow temperatures at the
+/// bottom nodes of all BHEs of a BHE field to the respective inflow
+/// temperatures.
 class BHEBottomDirichletBoundaryCondition final : public BoundaryCondition
 {
 public:
+    /// \param in_out_global_indices for each pipe the global indices of the
+    /// inflow and outflow temperatures at the bottom node of the BHE.
     explicit BHEBottomDirichletBoundaryCondition(
-        std::pair<GlobalIndexType, GlobalIndexType>&& in_out_global_indices)
+        std::vector<std::pair<GlobalIndexType, GlobalIndexType>>&&
+            in_out_global_indices)
         : _in_out_global_indices(std::move(in_out_global_indices))
     {
     }
@@ -29,10 +35,12 @@ public:
         NumLib::IndexValueVector<GlobalIndexType>& bc_values) const override;
 
 private:
-    std::pair<GlobalIndexType, GlobalIndexType> const _in_out_global_indices;
+    std::vector<std::pair<GlobalIndexType, GlobalIndexType>> const
+        _in_out_global_indices;
 };
 
 std::unique_ptr<BHEBottomDirichletBoundaryCondition>
 createBHEBottomDirichletBoundaryCondition(
-    std::pair<GlobalIndexType, GlobalIndexType>&& in_out_global_indices);
+    std::vector<std::pair<GlobalIndexType, GlobalIndexType>>&&
+        in_out_global_indices);
 }  // namespace ProcessLib::HeatTransportBHE
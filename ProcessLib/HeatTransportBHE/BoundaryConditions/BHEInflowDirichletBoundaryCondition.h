@@ -15,14 +15,26 @@
 
 namespace ProcessLib::HeatTransportBHE
 {
+/// Dirichlet boundary condition for the inflow temperatures of all BHEs of a
+/// BHE field. The inflow temperature of each pipe is computed from the
+/// outflow temperature at the top node of the BHE by the update callback
+/// which is called with the BHE's id.
 template <typename BHEUpdateCallback>
 class BHEInflowDirichletBoundaryCondition final : public BoundaryCondition
 {
 public:
+    /// \param in_out_global_indices for each pipe the global indices of the
+    /// inflow and outflow temperatures at the top node of the BHE.
+    /// \param bhe_ids for each pipe the id of the BHE it belongs to.
+    /// \param bhe_update_callback computes the inflow temperature from the
+    /// BHE id, the outflow temperature and the time.
     BHEInflowDirichletBoundaryCondition(
-        std::pair<GlobalIndexType, GlobalIndexType>&& in_out_global_indices,
+        std::vector<std::pair<GlobalIndexType, GlobalIndexType>>&&
+            in_out_global_indices,
+        std::vector<std::size_t>&& bhe_ids,
         BHEUpdateCallback bhe_update_callback)
         : _in_out_global_indices(std::move(in_out_global_indices)),
+          _bhe_ids(std::move(bhe_ids)),
           _bhe_update_callback(bhe_update_callback)
     {
     }
@@ -31,24 +43,32 @@ public:
         const double t, GlobalVector const& x,
         NumLib::IndexValueVector<GlobalIndexType>& bc_values) const override
     {
-        bc_values.ids.resize(1);
-        bc_values.values.resize(1);
+        auto const n = _in_out_global_indices.size();
+        bc_values.ids.resize(n);
+        bc_values.values.resize(n);
 
-        bc_values.ids[0] = _in_out_global_indices.first;
-        // here call the corresponding BHE functions
-        auto const T_out = x[_in_out_global_indices.second];
-        bc_values.values[0] = _bhe_update_callback(T_out, t);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            bc_values.ids[i] = _in_out_global_indices[i].first;
+            // here call the corresponding BHE functions
+            auto const T_out = x[_in_out_global_indices[i].second];
+            bc_values.values[i] = _bhe_update_callback(_bhe_ids[i], T_out, t);
+        }
     }
 
 private:
-    std::pair<GlobalIndexType, GlobalIndexType> const _in_out_global_indices;
+    std::vector<std::pair<GlobalIndexType, GlobalIndexType>> const
+        _in_out_global_indices;
+    std::vector<std::size_t> const _bhe_ids;
     BHEUpdateCallback _bhe_update_callback;
 };
 
 template <typename BHEUpdateCallback>
 std::unique_ptr<BHEInflowDirichletBoundaryCondition<BHEUpdateCallback>>
 createBHEInflowDirichletBoundaryCondition(
-    std::pair<GlobalIndexType, GlobalIndexType>&& in_out_global_indices,
+    std::vector<std::pair<GlobalIndexType, GlobalIndexType>>&&
+        in_out_global_indices,
+    std::vector<std::size_t>&& bhe_ids,
     BHEUpdateCallback bhe_update_callback)
 {
     DBUG("Constructing BHEInflowDirichletBoundaryCondition.");
@@ -57,23 +77,40 @@ createBHEInflowDirichletBoundaryCondition(
     // boundary condition.
 #ifdef USE_PETSC
     // For this special boundary condition the boundary condition is not empty
-    // if the global indices are non-negative.
-    if (in_out_global_indices.first < 0 && in_out_global_indices.second < 0)
+    // if the global indices are non-negative. BHEs of other partitions are
+    // removed.
+    std::size_t n_local = 0;
+    for (std::size_t i = 0; i < in_out_global_indices.size(); ++i)
     {
-        return nullptr;
+        auto const& in_out = in_out_global_indices[i];
+        if (in_out.first < 0 && in_out.second < 0)
+        {
+            continue;
+        }
+        // If only one of the global indices (in or out) is negative the
+        // implementation is not valid.
+        if (in_out.first < 0 || in_out.second < 0)
+        {
+            OGS_FATAL(
+                "The partition cuts the BHE into two independent parts. This "
+                "behaviour is not implemented.");
+        }
+        in_out_global_indices[n_local] = in_out;
+        bhe_ids[n_local] = bhe_ids[i];
+        n_local++;
     }
-    // If only one of the global indices (in or out) is negative the
-    // implementation is not valid.
-    if (in_out_global_indices.first < 0 || in_out_global_indices.second < 0)
+    in_out_global_indices.resize(n_local);
+    bhe_ids.resize(n_local);
+#endif  // USE_PETSC
+
+    if (in_out_global_indices.empty())
     {
-        OGS_FATAL(
-            "The partition cuts the BHE into two independent parts. This "
-            "behaviour is not implemented.");
+        return nullptr;
     }
-#endif  // USE_PETSC
 
     return std::make_unique<
         BHEInflowDirichletBoundaryCondition<BHEUpdateCallback>>(
-        std::move(in_out_global_indices), bhe_update_callback);
+        std::move(in_out_global_indices), std::move(bhe_ids),
+        bhe_update_callback);
 }
 }  // namespace ProcessLib::HeatTransportBHE
@@ -23,6 +23,53 @@ namespace ProcessLib
 {
 namespace HeatTransportBHE
 {
+#ifndef USE_PETSC
+namespace
+{
+/// Replaces the equation of the given row by
+/// \f$ s (x_{row} - a x_{column}) = s c \f$, where the scaling \f$ s \f$ is
+/// the magnitude of the replaced diagonal entry of K.
+void replaceEquation(GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b,
+                     GlobalIndexType const row, GlobalIndexType const column,
+                     double const a, double const c)
+{
+    double const diagonal = std::abs(K.getRawMatrix().coeff(row, row));
+    double const s = diagonal > 0 ? diagonal : 1;
+
+    for (auto* A : {&M, &K})
+    {
+        for (GlobalMatrix::RawMatrixType::InnerIterator it(A->getRawMatrix(),
+                                                            row);
+             it;
+             ++it)
+        {
+            it.valueRef() = 0;
+        }
+    }
+
+    K.setValue(row, row, s);
+    K.setValue(row, column, -s * a);
+    b.set(row, s * c);
+}
+
+std::vector<BHE::InflowTemperatureRelation> updateFlowRates(
+    std::vector<BHE::BHETypes>& bhes, double const t)
+{
+    std::vector<BHE::InflowTemperatureRelation> relations;
+    relations.reserve(bhes.size());
+    for (auto& bhe : bhes)
+    {
+        relations.push_back(apply_visitor(
+            [t](auto& bhe) {
+                return bhe.updateFlowRateAndInflowTemperatureRelation(t);
+            },
+            bhe));
+    }
+    return relations;
+}
+}  // namespace
+#endif  // USE_PETSC
+
 HeatTransportBHEProcess::HeatTransportBHEProcess(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -168,6 +215,13 @@ void HeatTransportBHEProcess::assembleConcreteProcess(const double t,
     const int process_id = 0;
     ProcessLib::ProcessVariable const& pv = getProcessVariables(process_id)[0];
 
+#ifndef USE_PETSC
+    // The flow rates depend on time only and are updated before the local
+    // assembly.
+    auto const inflow_temperature_relations =
+        updateFlowRates(_process_data._vec_BHE_property, t);
+#endif  // USE_PETSC
+
     std::vector<std::reference_wrapper<NumLib::LocalToGlobalIndexMap>>
         dof_table = {std::ref(*_local_to_global_index_map)};
     // Call global assembler for each local assembly item.
@@ -175,6 +229,10 @@ void HeatTransportBHEProcess::assembleConcreteProcess(const double t,
         _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
         pv.getActiveElementIDs(), dof_table, t, x, M, K, b,
         _coupled_solutions);
+
+#ifndef USE_PETSC
+    assembleBHEInflowOutflowRelations(inflow_temperature_relations, M, K, b);
+#endif  // USE_PETSC
 }
 
 void HeatTransportBHEProcess::assembleWithJacobianConcreteProcess(
@@ -201,9 +259,6 @@ void HeatTransportBHEProcess::computeSecondaryVariableConcrete(
 void HeatTransportBHEProcess::createBHEBoundaryConditionTopBottom(
     std::vector<std::vector<MeshLib::Node*>> const& all_bhe_nodes)
 {
-    const int process_id = 0;
-    auto& bcs = _boundary_conditions[process_id];
-
     int const n_BHEs = static_cast<int>(_process_data._vec_BHE_property.size());
 
     // for each BHE
@@ -236,28 +291,103 @@ void HeatTransportBHEProcess::createBHEBoundaryConditionTopBottom(
                         variable_id, in_out_component_id.second));
             };
 
-        auto createBCs = [&](auto& bhe) {
+        auto collectPipeIndices = [&](auto const& bhe) {
             for (auto const& in_out_component_id :
                  bhe.inflow_outflow_bc_component_ids)
             {
-                // Top, inflow.
-                bcs.addBoundaryCondition(
-                    createBHEInflowDirichletBoundaryCondition(
-                        get_global_bhe_bc_indices(bc_top_node_id,
-                                                  in_out_component_id),
-                        [&bhe](double const T, double const t) {
-                            return bhe.updateFlowRateAndTemperature(T, t);
-                        }));
-
-                // Bottom, outflow.
-                bcs.addBoundaryCondition(
-                    createBHEBottomDirichletBoundaryCondition(
-                        get_global_bhe_bc_indices(bc_bottom_node_id,
-                                                  in_out_component_id)));
+                _bhe_pipe_indices.push_back(
+                    {static_cast<std::size_t>(bhe_i),
+                     get_global_bhe_bc_indices(bc_top_node_id,
+                                               in_out_component_id),
+                     get_global_bhe_bc_indices(bc_bottom_node_id,
+                                               in_out_component_id)});
             }
         };
-        apply_visitor(createBCs, _process_data._vec_BHE_property[bhe_i]);
+        apply_visitor(collectPipeIndices,
+                      _process_data._vec_BHE_property[bhe_i]);
+    }
+
+#ifdef USE_PETSC
+    // In parallel runs the inflow and outflow temperatures are coupled by
+    // Dirichlet boundary conditions evaluated with the outflow temperatures
+    // of the previous iteration. The boundary conditions of all BHEs are
+    // evaluated by one inflow and one bottom boundary condition object.
+    const int process_id = 0;
+    auto& bcs = _boundary_conditions[process_id];
+
+    std::vector<std::pair<GlobalIndexType, GlobalIndexType>> top_in_out_indices;
+    std::vector<std::size_t> top_bhe_ids;
+    std::vector<std::pair<GlobalIndexType, GlobalIndexType>>
+        bottom_in_out_indices;
+    for (auto const& pipe : _bhe_pipe_indices)
+    {
+        top_in_out_indices.push_back(pipe.top_in_out);
+        top_bhe_ids.push_back(pipe.bhe_id);
+        bottom_in_out_indices.push_back(pipe.bottom_in_out);
+    }
+
+    auto& bhes = _process_data._vec_BHE_property;
+    for (std::size_t bhe_id = 0; bhe_id < bhes.size(); ++bhe_id)
+    {
+        auto const outflow_temperature_factor = apply_visitor(
+            [](auto const& bhe) {
+                return BHE::getOutflowTemperatureFactor(
+                    bhe.flowAndTemperatureControl);
+            },
+            bhes[bhe_id]);
+        if (outflow_temperature_factor != 0)
+        {
+            WARN(
+                "The inflow temperature of BHE %d depends on its outflow "
+                "temperature. In parallel runs it is evaluated with the "
+                "outflow temperature of the previous iteration; the "
+                "nonlinear solver needs additional iterations to converge "
+                "the inflow temperature.",
+                static_cast<int>(bhe_id));
+        }
+    }
+
+    auto inflow_bc = createBHEInflowDirichletBoundaryCondition(
+        std::move(top_in_out_indices), std::move(top_bhe_ids),
+        [&bhes](std::size_t const bhe_id, double const T, double const t) {
+            return apply_visitor(
+                [&](auto& bhe) {
+                    return bhe.updateFlowRateAndTemperature(T, t);
+                },
+                bhes[bhe_id]);
+        });
+    if (inflow_bc)
+    {
+        bcs.addBoundaryCondition(std::move(inflow_bc));
+    }
+
+    auto bottom_bc = createBHEBottomDirichletBoundaryCondition(
+        std::move(bottom_in_out_indices));
+    if (bottom_bc)
+    {
+        bcs.addBoundaryCondition(std::move(bottom_bc));
+    }
+#endif  // USE_PETSC
+}
+
+#ifndef USE_PETSC
+void HeatTransportBHEProcess::assembleBHEInflowOutflowRelations(
+    std::vector<BHE::InflowTemperatureRelation> const& relations,
+    GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b)
+{
+    for (auto const& pipe : _bhe_pipe_indices)
+    {
+        auto const& relation = relations[pipe.bhe_id];
+        // Top, T_in = a T_out + c.
+        replaceEquation(M, K, b, pipe.top_in_out.first,
+                        pipe.top_in_out.second,
+                        relation.outflow_temperature_factor,
+                        relation.temperature_offset);
+        // Bottom, T_out = T_in.
+        replaceEquation(M, K, b, pipe.bottom_in_out.second,
+                        pipe.bottom_in_out.first, 1, 0);
     }
 }
+#endif  // USE_PETSC
 }  // namespace HeatTransportBHE
 }  // namespace ProcessLib
@@ -65,6 +65,17 @@ private:
     void createBHEBoundaryConditionTopBottom(
         std::vector<std::vector<MeshLib::Node*>> const& all_bhe_nodes);
 
+#ifndef USE_PETSC
+    /// Replaces the assembled equations of the inflow temperature at the top
+    /// and of the outflow temperature at the bottom of each BHE pipe by the
+    /// linear relations between inflow and outflow temperature. Only the rows
+    /// are replaced, therefore the system becomes non-symmetric and can not be
+    /// solved by CG.
+    void assembleBHEInflowOutflowRelations(
+        std::vector<BHE::InflowTemperatureRelation> const& relations,
+        GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b);
+#endif  // USE_PETSC
+
     HeatTransportBHEProcessData _process_data;
 
     std::vector<std::unique_ptr<HeatTransportBHELocalAssemblerInterface>>
@@ -79,6 +90,17 @@ private:
     std::unique_ptr<MeshLib::MeshSubset const> _mesh_subset_soil_nodes;
 
     const BHEMeshData _bheMeshData;
+
+    /// Global indices of the inflow and outflow temperatures of a BHE pipe at
+    /// the top and the bottom node of the BHE.
+    struct BHEPipeIndices
+    {
+        std::size_t bhe_id;
+        std::pair<GlobalIndexType, GlobalIndexType> top_in_out;
+        std::pair<GlobalIndexType, GlobalIndexType> bottom_in_out;
+    };
+
+    std::vector<BHEPipeIndices> _bhe_pipe_indices;
 };
 }  // namespace HeatTransportBHE
 }  // namespace ProcessLib
@@ -1,3 +1,10 @@
+# The references of the BHE benchmarks were computed with the inflow
+# temperature as Dirichlet boundary condition, which was lagged by one Picard
+# iteration if it depends on the outflow temperature. Serial builds couple the
+# inflow and outflow temperatures in the global matrix instead. With a given
+# inflow temperature both give the same solution of a differently scaled
+# linear system; with a power control the references differ from the coupled
+# solution by up to the Picard tolerance (reltol) of the benchmark.
 AddTest(
     NAME HeatTransportBHE_1U_3D_beier_sandbox
     PATH Parabolic/T/3D_Beier_sandbox
@@ -8,8 +15,8 @@ AddTest(
     REQUIREMENTS NOT OGS_USE_MPI
     RUNTIME 20
     DIFF_DATA
-    beier_sandbox_pcs_0_ts_10_t_600.000000.vtu beier_sandbox_pcs_0_ts_10_t_600.000000.vtu temperature_BHE1 temperature_BHE1 0 5e-15
-    beier_sandbox_pcs_0_ts_10_t_600.000000.vtu beier_sandbox_pcs_0_ts_10_t_600.000000.vtu temperature_soil temperature_soil 0 1e-13
+    beier_sandbox_pcs_0_ts_10_t_600.000000.vtu beier_sandbox_pcs_0_ts_10_t_600.000000.vtu temperature_BHE1 temperature_BHE1 0 1e-12
+    beier_sandbox_pcs_0_ts_10_t_600.000000.vtu beier_sandbox_pcs_0_ts_10_t_600.000000.vtu temperature_soil temperature_soil 0 1e-12
 )
 
 AddTest(
@@ -22,8 +29,24 @@ AddTest(
     TESTER vtkdiff
     REQUIREMENTS NOT OGS_USE_MPI
     DIFF_DATA
-    fixed_power_constant_flow_pcs_0_ts_10_t_600.000000.vtu fixed_power_constant_flow_pcs_0_ts_10_t_600.000000.vtu temperature_BHE1 temperature_BHE1 0 5e-15
-    fixed_power_constant_flow_pcs_0_ts_10_t_600.000000.vtu fixed_power_constant_flow_pcs_0_ts_10_t_600.000000.vtu temperature_soil temperature_soil 0 1e-13
+    fixed_power_constant_flow_pcs_0_ts_10_t_600.000000.vtu fixed_power_constant_flow_pcs_0_ts_10_t_600.000000.vtu temperature_BHE1 temperature_BHE1 1e-8 0
+    fixed_power_constant_flow_pcs_0_ts_10_t_600.000000.vtu fixed_power_constant_flow_pcs_0_ts_10_t_600.000000.vtu temperature_soil temperature_soil 1e-8 0
+)
+
+# Compares to the results of fixed_power_constant_flow.prj with the same
+# tolerance; two Picard iterations suffice with the coupling in the matrix.
+AddTest(
+    NAME HeatTransportBHE_1U_beier_sandbox_fixed_power_constant_flow_two_iterations
+    PATH Parabolic/T/3D_Beier_sandbox
+    RUNTIME 20
+    EXECUTABLE ogs
+    EXECUTABLE_ARGS fixed_power_constant_flow_two_iterations.prj
+    WRAPPER time
+    TESTER vtkdiff
+    REQUIREMENTS NOT OGS_USE_MPI
+    DIFF_DATA
+    fixed_power_constant_flow_pcs_0_ts_10_t_600.000000.vtu fixed_power_constant_flow_two_iterations_pcs_0_ts_10_t_600.000000.vtu temperature_BHE1 temperature_BHE1 1e-8 0
+    fixed_power_constant_flow_pcs_0_ts_10_t_600.000000.vtu fixed_power_constant_flow_two_iterations_pcs_0_ts_10_t_600.000000.vtu temperature_soil temperature_soil 1e-8 0
 )
 
 AddTest(
@@ -35,8 +58,8 @@ AddTest(
     TESTER vtkdiff
     REQUIREMENTS NOT OGS_USE_MPI
     DIFF_DATA
-    3D_deep_BHE_CXA_pcs_0_ts_10_t_600.000000.vtu 3D_deep_BHE_CXA_pcs_0_ts_10_t_600.000000.vtu temperature_BHE1 temperature_BHE1 0 5e-15
-    3D_deep_BHE_CXA_pcs_0_ts_10_t_600.000000.vtu 3D_deep_BHE_CXA_pcs_0_ts_10_t_600.000000.vtu temperature_soil temperature_soil 0 1e-13
+    3D_deep_BHE_CXA_pcs_0_ts_10_t_600.000000.vtu 3D_deep_BHE_CXA_pcs_0_ts_10_t_600.000000.vtu temperature_BHE1 temperature_BHE1 0 1e-5
+    3D_deep_BHE_CXA_pcs_0_ts_10_t_600.000000.vtu 3D_deep_BHE_CXA_pcs_0_ts_10_t_600.000000.vtu temperature_soil temperature_soil 0 1e-5
 )
 
 AddTest(
@@ -48,6 +71,6 @@ AddTest(
     TESTER vtkdiff
     REQUIREMENTS NOT OGS_USE_MPI
     DIFF_DATA
-    3D_deep_BHE_CXC_pcs_0_ts_10_t_600.000000.vtu 3D_deep_BHE_CXC_pcs_0_ts_10_t_600.000000.vtu temperature_BHE1 temperature_BHE1 0 5e-15
-    3D_deep_BHE_CXC_pcs_0_ts_10_t_600.000000.vtu 3D_deep_BHE_CXC_pcs_0_ts_10_t_600.000000.vtu temperature_soil temperature_soil 0 1e-13
+    3D_deep_BHE_CXC_pcs_0_ts_10_t_600.000000.vtu 3D_deep_BHE_CXC_pcs_0_ts_10_t_600.000000.vtu temperature_BHE1 temperature_BHE1 0 1e-5
+    3D_deep_BHE_CXC_pcs_0_ts_10_t_600.000000.vtu 3D_deep_BHE_CXC_pcs_0_ts_10_t_600.000000.vtu temperature_soil temperature_soil 0 1e-5
 )
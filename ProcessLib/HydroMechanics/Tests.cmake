@@ -17,6 +17,20 @@ AddTest(
     GLOB square_1e2_pcs_0_ts_*.vtu HydraulicFlow HydraulicFlow 1e-15 1e-15
     GLOB square_1e2_pcs_0_ts_*.vtu NodalForces NodalForces 1e-15 1e-15
 )
+# Same as above until t = 100, solved with PETSc's field split
+# preconditioner using a Schur complement for the pressure.
+AddTest(
+    NAME HydroMechanics_HML_square_1e2_quad8_confined_compression_fieldsplit
+    PATH HydroMechanics/Linear/Confined_Compression
+    EXECUTABLE_ARGS square_1e2_fieldsplit.prj
+    WRAPPER mpirun
+    WRAPPER_ARGS -np 1
+    TESTER vtkdiff
+    REQUIREMENTS OGS_USE_MPI
+    DIFF_DATA
+    square_1e2_pcs_0_ts_20_t_100.000000.vtu square_1e2_fieldsplit_pcs_0_ts_20_t_100_000000_0.vtu displacement displacement 1e-10 1e-10
+    square_1e2_pcs_0_ts_20_t_100.000000.vtu square_1e2_fieldsplit_pcs_0_ts_20_t_100_000000_0.vtu pressure pressure 1e-10 1e-10
+)
 AddTest(
     NAME HydroMechanics_HML_square_1e2_quad9_confined_compression
     PATH HydroMechanics/Linear/Confined_Compression
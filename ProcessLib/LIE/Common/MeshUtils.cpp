@@ -8,6 +8,8 @@
 
 #include "MeshUtils.h"
 
+#include <algorithm>
+
 #include "BaseLib/Algorithm.h"
 #include "MeshLib/Elements/Element.h"
 #include "MeshLib/Mesh.h"
@@ -254,25 +256,31 @@ void getFractureMatrixDataInMesh(
     BaseLib::makeVectorUnique(vec_fracture_mat_IDs);
     DBUG("-> found %d fracture material groups", vec_fracture_mat_IDs.size());
 
-    // create a vector of fracture elements for each material
+    // create a vector of fracture elements for each material; the material
+    // IDs are sorted, so the fracture ID is found by a binary search
     vec_fracture_elements.resize(vec_fracture_mat_IDs.size());
+    for (MeshLib::Element* e : all_fracture_elements)
+    {
+        auto const frac_id = std::distance(
+            vec_fracture_mat_IDs.begin(),
+            std::lower_bound(vec_fracture_mat_IDs.begin(),
+                             vec_fracture_mat_IDs.end(),
+                             (*material_ids)[e->getID()]));
+        vec_fracture_elements[frac_id].push_back(e);
+    }
     for (unsigned frac_id = 0; frac_id < vec_fracture_mat_IDs.size(); frac_id++)
     {
-        const auto frac_mat_id = vec_fracture_mat_IDs[frac_id];
-        std::vector<MeshLib::Element*>& vec_elements =
-            vec_fracture_elements[frac_id];
-        std::copy_if(all_fracture_elements.begin(), all_fracture_elements.end(),
-                     std::back_inserter(vec_elements),
-                     [&](MeshLib::Element* e) {
-                         return (*material_ids)[e->getID()] == frac_mat_id;
-                     });
-        DBUG("-> found %d elements on the fracture %d", vec_elements.size(),
-             frac_id);
+        DBUG("-> found %d elements on the fracture %d",
+             vec_fracture_elements[frac_id].size(), frac_id);
     }
 
-    // get a vector of fracture nodes for each material
+    // get a vector of fracture nodes for each material; the fractures are
+    // independent of each other
+    auto const n_fractures =
+        static_cast<long long>(vec_fracture_mat_IDs.size());
     vec_fracture_nodes.resize(vec_fracture_mat_IDs.size());
-    for (unsigned frac_id = 0; frac_id < vec_fracture_mat_IDs.size(); frac_id++)
+#pragma omp parallel for
+    for (long long frac_id = 0; frac_id < n_fractures; frac_id++)
     {
         std::vector<MeshLib::Node*>& vec_nodes = vec_fracture_nodes[frac_id];
         for (MeshLib::Element* e : vec_fracture_elements[frac_id])
@@ -290,7 +298,11 @@ void getFractureMatrixDataInMesh(
             vec_nodes, [](MeshLib::Node* node1, MeshLib::Node* node2) {
                 return node1->getID() < node2->getID();
             });
-        DBUG("-> found %d nodes on the fracture %d", vec_nodes.size(), frac_id);
+    }
+    for (unsigned frac_id = 0; frac_id < vec_fracture_mat_IDs.size(); frac_id++)
+    {
+        DBUG("-> found %d nodes on the fracture %d",
+             vec_fracture_nodes[frac_id].size(), frac_id);
     }
 
     // find branch/junction nodes which connect to multiple fractures
@@ -302,10 +314,13 @@ void getFractureMatrixDataInMesh(
 
     // create a vector fracture elements and connected matrix elements,
     // which are passed to a DoF table
-    for (unsigned fid = 0; fid < vec_fracture_elements.size(); fid++)
+    vec_fracture_matrix_elements.resize(vec_fracture_elements.size());
+#pragma omp parallel for
+    for (long long fid = 0; fid < n_fractures; fid++)
     {
         auto const& fracture_elements = vec_fracture_elements[fid];
-        std::vector<MeshLib::Element*> vec_ele;
+        std::vector<MeshLib::Element*>& vec_ele =
+            vec_fracture_matrix_elements[fid];
         // first, collect matrix elements
         for (MeshLib::Element* e : fracture_elements)
         {
@@ -343,8 +358,6 @@ void getFractureMatrixDataInMesh(
         std::copy(intersected_fracture_elements[fid].begin(),
                   intersected_fracture_elements[fid].end(),
                   std::back_inserter(vec_ele));
-
-        vec_fracture_matrix_elements.push_back(vec_ele);
     }
 }
 
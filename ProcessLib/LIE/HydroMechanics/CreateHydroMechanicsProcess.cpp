@@ -359,6 +359,7 @@ std::unique_ptr<Process> createHydroMechanicsProcess(
         std::move(named_function_caller), use_monolithic_scheme);
 }
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 template std::unique_ptr<Process> createHydroMechanicsProcess<2>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -369,6 +370,8 @@ template std::unique_ptr<Process> createHydroMechanicsProcess<2>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 template std::unique_ptr<Process> createHydroMechanicsProcess<3>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -379,6 +382,7 @@ template std::unique_ptr<Process> createHydroMechanicsProcess<3>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
 }  // namespace HydroMechanics
 }  // namespace LIE
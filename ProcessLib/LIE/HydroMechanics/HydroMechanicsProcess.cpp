@@ -629,8 +629,12 @@ void HydroMechanicsProcess<GlobalDim>::preTimestepConcreteProcess(
 // ------------------------------------------------------------------------------------
 // template instantiation
 // ------------------------------------------------------------------------------------
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 template class HydroMechanicsProcess<2>;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 template class HydroMechanicsProcess<3>;
+#endif
 
 }  // namespace HydroMechanics
 }  // namespace LIE
@@ -34,12 +34,17 @@ HydroMechanicsLocalAssemblerMatrixNearFracture<ShapeFunctionDisplacement,
                                          ShapeFunctionPressure,
                                          IntegrationMethod, GlobalDim>(
           e, n_variables, local_matrix_size, dofIndex_to_localIndex,
-          is_axially_symmetric, integration_order, process_data),
-      _e_center_coords(e.getCenterOfGravity().getCoords())
+          is_axially_symmetric, integration_order, process_data)
 {
     // currently not supporting multiple fractures
     _fracture_props.push_back(process_data.fracture_property.get());
     _fracID_to_local.insert({0, 0});
+
+    // levelset value of the element
+    // remark: this assumes the levelset function is uniform within an element
+    _ele_levelset = uGlobalEnrichments(
+        _fracture_props, _junction_props, _fracID_to_local,
+        Eigen::Vector3d(e.getCenterOfGravity().getCoords()))[0];
 }
 
 template <typename ShapeFunctionDisplacement, typename ShapeFunctionPressure,
@@ -77,11 +82,7 @@ void HydroMechanicsLocalAssemblerMatrixNearFracture<
     auto J_uu = local_J.block(displacement_index, displacement_index,
                               displacement_size, displacement_size);
 
-    // levelset value of the element
-    // remark: this assumes the levelset function is uniform within an element
-    std::vector<double> levelsets = uGlobalEnrichments(
-        _fracture_props, _junction_props, _fracID_to_local, _e_center_coords);
-    double const ele_levelset = levelsets[0];  // single fracture
+    double const ele_levelset = _ele_levelset;  // single fracture
 
     if (ele_levelset == 0)
     {
@@ -142,11 +143,7 @@ void HydroMechanicsLocalAssemblerMatrixNearFracture<
     }
     auto u = local_x.segment(displacement_index, displacement_size);
 
-    // levelset value of the element
-    // remark: this assumes the levelset function is uniform within an element
-    std::vector<double> levelsets = uGlobalEnrichments(
-        _fracture_props, _junction_props, _fracID_to_local, _e_center_coords);
-    double const ele_levelset = levelsets[0];  // single fracture
+    double const ele_levelset = _ele_levelset;  // single fracture
 
     if (ele_levelset == 0)
     {
@@ -90,7 +90,9 @@ private:
     std::vector<FractureProperty*> _fracture_props;
     std::vector<JunctionProperty*> _junction_props;
     std::unordered_map<int, int> _fracID_to_local;
-    Eigen::Vector3d _e_center_coords;
+    /// The levelset value at the element center, which depends on the
+    /// geometry only and is therefore computed once.
+    double _ele_levelset;
 };
 
 }  // namespace HydroMechanics
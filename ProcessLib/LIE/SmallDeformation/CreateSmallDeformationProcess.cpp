@@ -200,6 +200,7 @@ std::unique_ptr<Process> createSmallDeformationProcess(
         std::move(named_function_caller));
 }
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 template std::unique_ptr<Process> createSmallDeformationProcess<2>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -210,7 +211,9 @@ template std::unique_ptr<Process> createSmallDeformationProcess<2>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 template std::unique_ptr<Process> createSmallDeformationProcess<3>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -221,6 +224,7 @@ template std::unique_ptr<Process> createSmallDeformationProcess<3>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
 }  // namespace SmallDeformation
 }  // namespace LIE
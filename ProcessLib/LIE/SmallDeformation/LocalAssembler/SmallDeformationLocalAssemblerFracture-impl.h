@@ -53,6 +53,7 @@ SmallDeformationLocalAssemblerFracture<ShapeFunction, IntegrationMethod,
         _integration_method.getNumberOfPoints();
 
     _ip_data.reserve(n_integration_points);
+    _ip_levelsets.reserve(n_integration_points);
     _secondary_data.N.resize(n_integration_points);
 
     auto mat_id = (*_process_data._mesh_prop_materialIDs)[e.getID()];
@@ -102,6 +103,14 @@ SmallDeformationLocalAssemblerFracture<ShapeFunction, IntegrationMethod,
         ip_data.aperture_prev = ip_data.aperture0;
 
         _secondary_data.N[ip] = sm.N;
+
+        // The enrichment functions depend on the geometry only and are
+        // evaluated once.
+        Eigen::Vector3d const ip_physical_coords(
+            computePhysicalCoordinates(_element, sm.N).getCoords());
+        _ip_levelsets.push_back(duGlobalEnrichments(
+            _fracture_property->fracture_id, _fracture_props, _junction_props,
+            _fracID_to_local, ip_physical_coords));
     }
 }
 
@@ -189,13 +198,7 @@ void SmallDeformationLocalAssemblerFracture<
         auto const& w_prev = ip_data.w_prev;
         auto& C = ip_data.C;
         auto& state = *ip_data.material_state_variables;
-        auto& N = _secondary_data.N[ip];
-
-        Eigen::Vector3d const ip_physical_coords(
-            computePhysicalCoordinates(_element, N).getCoords());
-        std::vector<double> const levelsets(duGlobalEnrichments(
-            _fracture_property->fracture_id, _fracture_props, _junction_props,
-            _fracID_to_local, ip_physical_coords));
+        auto const& levelsets = _ip_levelsets[ip];
 
         // du = du^hat + sum_i(enrich^br_i(x) * [u]_i) + sum_i(enrich^junc_i(x)
         // * [u]_i)
@@ -289,13 +292,7 @@ void SmallDeformationLocalAssemblerFracture<ShapeFunction, IntegrationMethod,
         auto& C = ip_data.C;
         auto& state = *ip_data.material_state_variables;
         auto& b_m = ip_data.aperture;
-        auto& N = _secondary_data.N[ip];
-
-        Eigen::Vector3d const ip_physical_coords(
-            computePhysicalCoordinates(_element, N).getCoords());
-        std::vector<double> const levelsets(duGlobalEnrichments(
-            _fracture_property->fracture_id, _fracture_props, _junction_props,
-            _fracID_to_local, ip_physical_coords));
+        auto const& levelsets = _ip_levelsets[ip];
 
         // du = du^hat + sum_i(enrich^br_i(x) * [u]_i) + sum_i(enrich^junc_i(x)
         // * [u]_i)
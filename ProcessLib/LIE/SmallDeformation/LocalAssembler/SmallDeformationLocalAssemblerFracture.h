@@ -237,6 +237,9 @@ private:
     std::vector<JunctionProperty*> _junction_props;
     std::unordered_map<int, int> _fracID_to_local;
     FractureProperty const* _fracture_property = nullptr;
+    /// Enrichment values of all fractures and junctions at each integration
+    /// point.
+    std::vector<std::vector<double>> _ip_levelsets;
 
     std::vector<IntegrationPointDataFracture<HMatricesType, DisplacementDim>,
                 Eigen::aligned_allocator<IntegrationPointDataFracture<
@@ -121,6 +121,18 @@ SmallDeformationLocalAssemblerMatrixNearFracture<ShapeFunction,
     {
         _junction_props.push_back(&_process_data.junction_properties[jid]);
     }
+
+    // The enrichment functions depend on the geometry only and are evaluated
+    // once for all integration points.
+    _ip_levelsets.reserve(n_integration_points);
+    for (unsigned ip = 0; ip < n_integration_points; ip++)
+    {
+        Eigen::Vector3d const ip_physical_coords(
+            computePhysicalCoordinates(e, _ip_data[ip].N).getCoords());
+        _ip_levelsets.push_back(
+            uGlobalEnrichments(_fracture_props, _junction_props,
+                               _fracID_to_local, ip_physical_coords));
+    }
 }
 
 template <typename ShapeFunction,
@@ -220,11 +232,7 @@ void SmallDeformationLocalAssemblerMatrixNearFracture<
         auto const& dNdx = ip_data.dNdx;
 
         // levelset functions
-        Eigen::Vector3d const ip_physical_coords(
-            computePhysicalCoordinates(_element, N).getCoords());
-        std::vector<double> const levelsets(
-            uGlobalEnrichments(_fracture_props, _junction_props,
-                               _fracID_to_local, ip_physical_coords));
+        auto const& levelsets = _ip_levelsets[ip];
 
         // u = u^hat + sum_i(enrich^br_i(x) * [u]_i) + sum_i(enrich^junc_i(x) *
         // [u]_i)
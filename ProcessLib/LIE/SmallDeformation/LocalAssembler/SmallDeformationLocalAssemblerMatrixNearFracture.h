@@ -264,6 +264,9 @@ private:
     std::vector<FractureProperty*> _fracture_props;
     std::vector<JunctionProperty*> _junction_props;
     std::unordered_map<int, int> _fracID_to_local;
+    /// Enrichment values of all fractures and junctions at each integration
+    /// point.
+    std::vector<std::vector<double>> _ip_levelsets;
 
     std::vector<IntegrationPointDataMatrix<ShapeMatricesType, BMatricesType,
                                            DisplacementDim>,
@@ -414,12 +414,54 @@ void SmallDeformationProcess<DisplacementDim>::initializeConcreteProcess(
         _process_data._mesh_prop_strain_yz = mesh_prop_epsilon_yz;
     }
 
+    // The levelset properties of all fractures and junctions are created
+    // once, before they are filled independently for each element.
+    auto const n_fractures = _process_data.fracture_properties.size();
+    std::vector<MeshLib::PropertyVector<double>*> mesh_prop_levelsets;
+    std::vector<bool> has_levelset(
+        n_fractures + _process_data.junction_properties.size(), false);
     for (MeshLib::Element const* e : _mesh.getElements())
     {
         if (e->getDimension() < DisplacementDim)
         {
             continue;
         }
+        for (auto fid :
+             _process_data._vec_ele_connected_fractureIDs[e->getID()])
+        {
+            has_levelset[fid] = true;
+        }
+        for (auto jid :
+             _process_data._vec_ele_connected_junctionIDs[e->getID()])
+        {
+            has_levelset[n_fractures + jid] = true;
+        }
+    }
+    for (std::size_t i = 0; i < has_levelset.size(); i++)
+    {
+        if (!has_levelset[i])
+        {
+            mesh_prop_levelsets.push_back(nullptr);
+            continue;
+        }
+        auto mesh_prop_levelset = MeshLib::getOrCreateMeshProperty<double>(
+            const_cast<MeshLib::Mesh&>(mesh),
+            "levelset" + std::to_string(i + 1), MeshLib::MeshItemType::Cell,
+            1);
+        mesh_prop_levelset->resize(mesh.getNumberOfElements());
+        mesh_prop_levelsets.push_back(mesh_prop_levelset);
+    }
+
+    auto const& elements = _mesh.getElements();
+    auto const n_elements = static_cast<long long>(elements.size());
+#pragma omp parallel for
+    for (long long element_id = 0; element_id < n_elements; element_id++)
+    {
+        MeshLib::Element const* e = elements[element_id];
+        if (e->getDimension() < DisplacementDim)
+        {
+            continue;
+        }
 
         Eigen::Vector3d const pt(e->getCenterOfGravity().getCoords());
         std::vector<FractureProperty*> e_fracture_props;
@@ -432,38 +474,24 @@ void SmallDeformationProcess<DisplacementDim>::initializeConcreteProcess(
             e_fracID_to_local.insert({fid, tmpi++});
         }
         std::vector<JunctionProperty*> e_junction_props;
-        std::unordered_map<int, int> e_juncID_to_local;
-        tmpi = 0;
-        for (auto fid :
+        for (auto jid :
              _process_data._vec_ele_connected_junctionIDs[e->getID()])
         {
-            e_junction_props.push_back(&_process_data.junction_properties[fid]);
-            e_juncID_to_local.insert({fid, tmpi++});
+            e_junction_props.push_back(&_process_data.junction_properties[jid]);
         }
         std::vector<double> const levelsets(uGlobalEnrichments(
             e_fracture_props, e_junction_props, e_fracID_to_local, pt));
 
         for (unsigned i = 0; i < e_fracture_props.size(); i++)
         {
-            auto mesh_prop_levelset = MeshLib::getOrCreateMeshProperty<double>(
-                const_cast<MeshLib::Mesh&>(mesh),
-                "levelset" +
-                    std::to_string(e_fracture_props[i]->fracture_id + 1),
-                MeshLib::MeshItemType::Cell, 1);
-            mesh_prop_levelset->resize(mesh.getNumberOfElements());
-            (*mesh_prop_levelset)[e->getID()] = levelsets[i];
+            (*mesh_prop_levelsets[e_fracture_props[i]->fracture_id])
+                [e->getID()] = levelsets[i];
         }
         for (unsigned i = 0; i < e_junction_props.size(); i++)
         {
-            auto mesh_prop_levelset = MeshLib::getOrCreateMeshProperty<double>(
-                const_cast<MeshLib::Mesh&>(mesh),
-                "levelset" +
-                    std::to_string(e_junction_props[i]->junction_id + 1 +
-                                   _process_data.fracture_properties.size()),
-                MeshLib::MeshItemType::Cell, 1);
-            mesh_prop_levelset->resize(mesh.getNumberOfElements());
-            (*mesh_prop_levelset)[e->getID()] =
-                levelsets[i + e_fracture_props.size()];
+            (*mesh_prop_levelsets[n_fractures +
+                                  e_junction_props[i]->junction_id])
+                [e->getID()] = levelsets[i + e_fracture_props.size()];
         }
     }
 
@@ -598,8 +626,12 @@ void SmallDeformationProcess<DisplacementDim>::preTimestepConcreteProcess(
 // ------------------------------------------------------------------------------------
 // template instantiation
 // ------------------------------------------------------------------------------------
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 template class SmallDeformationProcess<2>;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 template class SmallDeformationProcess<3>;
+#endif
 
 }  // namespace SmallDeformation
 }  // namespace LIE
@@ -96,8 +96,12 @@ private:
     std::unique_ptr<MeshLib::MeshSubset const> _mesh_subset_matrix_nodes;
 };
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 extern template class SmallDeformationProcess<2>;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 extern template class SmallDeformationProcess<3>;
+#endif
 
 }  // namespace SmallDeformation
 }  // namespace LIE
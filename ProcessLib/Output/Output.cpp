@@ -150,6 +150,13 @@ Output::ProcessData* Output::findProcessData(Process const& process,
     return process_data;
 }
 
+PrimaryVariableOutputIndices& Output::getPrimaryVariableOutputIndices(
+    Process const& process, const int process_id, MeshLib::Mesh const& mesh)
+{
+    return _primary_variable_output_indices[std::make_tuple(
+        &process, process_id, mesh.getName())];
+}
+
 struct Output::OutputFile
 {
     OutputFile(std::string const& directory, std::string const& prefix,
@@ -199,6 +206,8 @@ void Output::doOutputAlways(Process const& process,
     bool output_secondary_variable = true;
     // Need to add variables of process to vtu even no output takes place.
     processOutputData(t, x, process.getMesh(), process.getDOFTable(process_id),
+                      getPrimaryVariableOutputIndices(process, process_id,
+                                                      process.getMesh()),
                       process.getProcessVariables(process_id),
                       process.getSecondaryVariables(),
                       output_secondary_variable,
@@ -253,6 +262,8 @@ void Output::doOutputAlways(Process const& process,
 
         output_secondary_variable = false;
         processOutputData(t, x, mesh, *mesh_dof_table,
+                          getPrimaryVariableOutputIndices(process, process_id,
+                                                          mesh),
                           process.getProcessVariables(process_id),
                           process.getSecondaryVariables(),
                           output_secondary_variable,
@@ -327,6 +338,8 @@ void Output::doOutputNonlinearIteration(Process const& process,
 
     bool const output_secondary_variable = true;
     processOutputData(t, x, process.getMesh(), process.getDOFTable(process_id),
+                      getPrimaryVariableOutputIndices(process, process_id,
+                                                      process.getMesh()),
                       process.getProcessVariables(process_id),
                       process.getSecondaryVariables(),
                       output_secondary_variable,
@@ -10,6 +10,8 @@
 #pragma once
 
 #include <map>
+#include <string>
+#include <tuple>
 #include <utility>
 
 #include "MeshLib/IO/VtkIO/PVDFile.h"
@@ -121,12 +123,25 @@ private:
      */
     ProcessData* findProcessData(Process const& process, const int process_id);
 
+    /// Returns the cached primary variable output indices for the given
+    /// process, process id and output mesh. On first access an empty entry is
+    /// created, which is filled by processOutputData().
+    PrimaryVariableOutputIndices& getPrimaryVariableOutputIndices(
+        Process const& process, const int process_id,
+        MeshLib::Mesh const& mesh);
+
     //! Determines if there should be output at the given \c timestep or \c t.
     bool shallDoOutput(int timestep, double const t);
 
     ProcessOutput const _process_output;
     std::vector<std::string> const _mesh_names_for_output;
     std::vector<std::unique_ptr<MeshLib::Mesh>> const& _meshes;
+
+    //! Primary variable output indices per process, process id, and output
+    //! mesh name.
+    std::map<std::tuple<Process const*, int, std::string>,
+             PrimaryVariableOutputIndices>
+        _primary_variable_output_indices;
 };
 
 
@@ -9,6 +9,8 @@
 
 #include "ProcessOutput.h"
 
+#include <cassert>
+
 #include "BaseLib/BuildInfo.h"
 #include "MathLib/LinAlg/LinAlg.h"
 #include "MeshLib/IO/VtkIO/VtuInterface.h"
@@ -126,11 +128,70 @@ static void addSecondaryVariableResiduals(
 
 namespace ProcessLib
 {
+static PrimaryVariableOutputIndices computePrimaryVariableOutputIndices(
+    GlobalVector const& x,
+    MeshLib::Mesh const& mesh,
+    NumLib::LocalToGlobalIndexMap const& dof_table,
+    std::vector<std::reference_wrapper<ProcessVariable>> const&
+        process_variables)
+{
+    PrimaryVariableOutputIndices primary_variable_indices;
+    primary_variable_indices.reserve(process_variables.size());
+
+    int global_component_offset = 0;
+    int global_component_offset_next = 0;
+
+    const auto number_of_dof_variables = dof_table.getNumberOfVariables();
+    for (int variable_id = 0;
+         variable_id < static_cast<int>(process_variables.size());
+         ++variable_id)
+    {
+        ProcessVariable const& pv = process_variables[variable_id];
+        int const n_components = pv.getNumberOfComponents();
+        // If (number_of_dof_variables==1), the case is either the staggered
+        // scheme being applied or a single PDE being solved.
+        const int sub_meshset_id =
+            (number_of_dof_variables == 1) ? 0 : variable_id;
+
+        if (number_of_dof_variables > 1)
+        {
+            global_component_offset = global_component_offset_next;
+            global_component_offset_next += n_components;
+        }
+
+        std::vector<GlobalIndexType> indices(
+            mesh.getNumberOfNodes() * n_components, -1);
+
+        for (int component_id = 0; component_id < n_components; ++component_id)
+        {
+            auto const& mesh_subset =
+                dof_table.getMeshSubset(sub_meshset_id, component_id);
+            auto const mesh_id = mesh_subset.getMeshID();
+            auto const global_component_id =
+                global_component_offset + component_id;
+            for (auto const* node : mesh_subset.getNodes())
+            {
+                MeshLib::Location const l(mesh_id, MeshLib::MeshItemType::Node,
+                                          node->getID());
+
+                indices[node->getID() * n_components + component_id] =
+                    dof_table.getLocalIndex(l, global_component_id,
+                                            x.getRangeBegin(),
+                                            x.getRangeEnd());
+            }
+        }
+        primary_variable_indices.push_back(std::move(indices));
+    }
+
+    return primary_variable_indices;
+}
+
 void processOutputData(
     const double t,
     GlobalVector const& x,
     MeshLib::Mesh& mesh,
     NumLib::LocalToGlobalIndexMap const& dof_table,
+    PrimaryVariableOutputIndices& primary_variable_indices,
     std::vector<std::reference_wrapper<ProcessVariable>> const&
         process_variables,
     SecondaryVariableCollection const& secondary_variables,
@@ -143,41 +204,37 @@ void processOutputData(
 
     addOgsVersion(mesh);
 
-    // Copy result
+    if (primary_variable_indices.empty())
+    {
+        primary_variable_indices = computePrimaryVariableOutputIndices(
+            x, mesh, dof_table, process_variables);
+    }
+    if (primary_variable_indices.size() != process_variables.size())
+    {
+        OGS_FATAL(
+            "The number of cached primary variable output indices (%d) does "
+            "not match the number of process variables (%d).",
+            primary_variable_indices.size(), process_variables.size());
+    }
+
 #ifdef USE_PETSC
-    // TODO It is also possible directly to copy the data for single process
-    // variable to a mesh property. It needs a vector of global indices and
-    // some PETSc magic to do so.
+    // The indices refer to the local part of the vector including ghosts.
     std::vector<double> x_copy(x.getLocalSize() + x.getGhostSize());
+    x.copyValues(x_copy);
+    auto const* const x_values = x_copy.data();
 #else
-    std::vector<double> x_copy(x.size());
+    // Read the values directly from the solution vector; no copy is needed.
+    auto const* const x_values = x.getRawVector().data();
 #endif
-    x.copyValues(x_copy);
 
     auto const& output_variables = process_output.output_variables;
     std::set<std::string> already_output;
 
-    int global_component_offset = 0;
-    int global_component_offset_next = 0;
-
-    const auto number_of_dof_variables = dof_table.getNumberOfVariables();
-    // primary variables
     for (int variable_id = 0;
          variable_id < static_cast<int>(process_variables.size());
          ++variable_id)
     {
         ProcessVariable& pv = process_variables[variable_id];
-        int const n_components = pv.getNumberOfComponents();
-        // If (number_of_dof_variables==1), the case is either the staggered
-        // scheme being applied or a single PDE being solved.
-        const int sub_meshset_id =
-            (number_of_dof_variables == 1) ? 0 : variable_id;
-
-        if (number_of_dof_variables > 1)
-        {
-            global_component_offset = global_component_offset_next;
-            global_component_offset_next += n_components;
-        }
 
         if (output_variables.find(pv.getName()) == output_variables.cend())
         {
@@ -192,24 +249,13 @@ void processOutputData(
         auto& output_data = *MeshLib::getOrCreateMeshProperty<double>(
             mesh, pv.getName(), MeshLib::MeshItemType::Node, num_comp);
 
-
-        for (int component_id = 0; component_id < num_comp; ++component_id)
+        auto const& indices = primary_variable_indices[variable_id];
+        assert(indices.size() == output_data.size());
+        for (std::size_t i = 0; i < indices.size(); ++i)
         {
-            auto const& mesh_subset =
-                dof_table.getMeshSubset(sub_meshset_id, component_id);
-            auto const mesh_id = mesh_subset.getMeshID();
-            for (auto const* node : mesh_subset.getNodes())
+            if (indices[i] >= 0)
             {
-                MeshLib::Location const l(mesh_id, MeshLib::MeshItemType::Node,
-                                          node->getID());
-
-                auto const global_component_id =
-                    global_component_offset + component_id;
-                auto const index = dof_table.getLocalIndex(
-                    l, global_component_id, x.getRangeBegin(), x.getRangeEnd());
-
-                output_data[node->getID() * n_components + component_id] =
-                    x_copy[index];
+                output_data[i] = x_values[indices[i]];
             }
         }
     }
@@ -26,13 +26,27 @@ struct ProcessOutput final
     bool const output_residuals;
 };
 
+//! Indices of the primary variables' nodal values in the (local part of the)
+//! solution vector. For each process variable there is one vector holding the
+//! index for each node and component in the same node-major ordering as the
+//! output mesh property; nodes not carrying a component have index -1.
+//!
+//! The indices only depend on the d.o.f. table and are computed on the first
+//! call of processOutputData(); subsequent calls only gather the values.
+using PrimaryVariableOutputIndices = std::vector<std::vector<GlobalIndexType>>;
+
 ///
 /// Prepare the output data, i.e. add the solution to vtu data structure.
+///
+/// If \c primary_variable_indices is empty, it is filled using the
+/// \c dof_table. Otherwise it must have been computed for the same
+/// \c dof_table and \c mesh in a previous call.
 void processOutputData(
     const double t,
     GlobalVector const& x,
     MeshLib::Mesh& mesh,
     NumLib::LocalToGlobalIndexMap const& dof_table,
+    PrimaryVariableOutputIndices& primary_variable_indices,
     std::vector<std::reference_wrapper<ProcessVariable>> const&
         process_variables,
     SecondaryVariableCollection const& secondary_variables,
@@ -211,6 +211,7 @@ std::unique_ptr<Process> createPhaseFieldProcess(
         std::move(named_function_caller), use_monolithic_scheme);
 }
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 template std::unique_ptr<Process> createPhaseFieldProcess<2>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -221,7 +222,9 @@ template std::unique_ptr<Process> createPhaseFieldProcess<2>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 template std::unique_ptr<Process> createPhaseFieldProcess<3>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -232,6 +235,7 @@ template std::unique_ptr<Process> createPhaseFieldProcess<3>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
 }  // namespace PhaseField
 }  // namespace ProcessLib
@@ -49,6 +49,7 @@ std::unique_ptr<Process> createPhaseFieldProcess(
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 extern template std::unique_ptr<Process> createPhaseFieldProcess<2>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -59,7 +60,9 @@ extern template std::unique_ptr<Process> createPhaseFieldProcess<2>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 extern template std::unique_ptr<Process> createPhaseFieldProcess<3>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -70,5 +73,6 @@ extern template std::unique_ptr<Process> createPhaseFieldProcess<3>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 }  // namespace PhaseField
 }  // namespace ProcessLib
@@ -358,8 +358,12 @@ bool PhaseFieldProcess<DisplacementDim>::isPhaseFieldProcess(
     return process_id == 1;
 }
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 template class PhaseFieldProcess<2>;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 template class PhaseFieldProcess<3>;
+#endif
 
 }  // namespace PhaseField
 }  // namespace ProcessLib
@@ -127,8 +127,12 @@ private:
     bool isPhaseFieldProcess(int const process_id) const;
 };
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 extern template class PhaseFieldProcess<2>;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 extern template class PhaseFieldProcess<3>;
+#endif
 
 }  // namespace PhaseField
 }  // namespace ProcessLib
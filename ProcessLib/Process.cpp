@@ -11,6 +11,7 @@
 
 #include "BaseLib/Functional.h"
 #include "NumLib/DOF/ComputeSparsityPattern.h"
+#include "NumLib/DOF/DOFTableUtil.h"
 #include "NumLib/Extrapolation/LocalLinearLeastSquaresExtrapolator.h"
 #include "NumLib/ODESolver/ConvergenceCriterionPerComponent.h"
 #include "ParameterLib/Parameter.h"
@@ -91,6 +92,35 @@ void Process::initializeBoundaryConditions()
     }
 }
 
+void Process::recordAssemblyCosts()
+{
+    std::string const name = "assembly_cost";
+    auto& properties = _mesh.getProperties();
+    MeshLib::PropertyVector<double>* assembly_costs = nullptr;
+    if (!properties.hasPropertyVector(name))
+    {
+        assembly_costs = properties.createNewPropertyVector<double>(
+            name, MeshLib::MeshItemType::Cell, 1);
+    }
+    else if (properties.existsPropertyVector<double>(
+                 name, MeshLib::MeshItemType::Cell, 1))
+    {
+        assembly_costs = properties.getPropertyVector<double>(name);
+    }
+    else
+    {
+        OGS_FATAL(
+            "The mesh property '%s' exists but is not a scalar cell property "
+            "of type double; the assembly costs cannot be recorded.",
+            name.c_str());
+    }
+    // Start from zero; costs of an earlier run stored in the mesh file are
+    // discarded.
+    assembly_costs->assign(_mesh.getNumberOfElements(), 0.0);
+
+    _global_assembler.recordAssemblyCosts(assembly_costs);
+}
+
 void Process::initialize()
 {
     DBUG("Initialize process.");
@@ -101,6 +131,8 @@ void Process::initialize()
     DBUG("Compute sparsity pattern");
     computeSparsityPattern();
 
+    computeFieldSplits();
+
     DBUG("Initialize the extrapolator");
     initializeExtrapolator();
 
@@ -175,7 +207,8 @@ MathLib::MatrixSpecifications Process::getMatrixSpecifications(
 {
     auto const& l = *_local_to_global_index_map;
     return {l.dofSizeWithoutGhosts(), l.dofSizeWithoutGhosts(),
-            &l.getGhostIndices(), &_sparsity_pattern};
+            &l.getGhostIndices(), &_sparsity_pattern, &_field_splits,
+            _matrix_block_size};
 }
 
 void Process::updateDeactivatedSubdomains(double const time,
@@ -346,6 +379,36 @@ void Process::computeSparsityPattern()
         NumLib::computeSparsityPattern(*_local_to_global_index_map, _mesh);
 }
 
+void Process::computeFieldSplits()
+{
+#ifdef USE_PETSC
+    if (!_use_monolithic_scheme)
+    {
+        return;
+    }
+
+    auto const& process_variables = _process_variables[0];
+    if (process_variables.size() < 2 ||
+        static_cast<std::size_t>(
+            _local_to_global_index_map->getNumberOfVariables()) !=
+            process_variables.size())
+    {
+        return;
+    }
+
+    DBUG("Compute field splits");
+    std::vector<std::string> variable_names;
+    for (auto const& pv : process_variables)
+    {
+        variable_names.push_back(pv.get().getName());
+    }
+    _field_splits =
+        NumLib::computeFieldSplits(*_local_to_global_index_map, variable_names);
+    _matrix_block_size =
+        NumLib::computeInterleavedBlockSize(*_local_to_global_index_map);
+#endif
+}
+
 void Process::preTimestep(GlobalVector const& x, const double t,
                           const double delta_t, const int process_id)
 {
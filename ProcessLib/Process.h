@@ -121,6 +121,15 @@ public:
     }
 
     MeshLib::Mesh& getMesh() const { return _mesh; }
+
+    /// Records the accumulated wall-clock time of the assembly of each element
+    /// in the cell property "assembly_cost" of the process' mesh, which is
+    /// written with the output. Processes sharing a mesh add up their costs.
+    /// The values can be used as element weights for the mesh partitioning,
+    /// see partmesh's --element_weights option. Only meaningful for serial
+    /// runs, since the costs are stored by local element id.
+    void recordAssemblyCosts();
+
     std::vector<std::reference_wrapper<ProcessVariable>> const&
     getProcessVariables(const int process_id) const
     {
@@ -259,6 +268,11 @@ private:
     /// DOF-table.
     void computeSparsityPattern();
 
+    /// Computes and stores the global matrix' rows of each process variable
+    /// for the monolithic scheme. Only used by PETSc's field split
+    /// preconditioner.
+    void computeFieldSplits();
+
 public:
     std::string const name;
 
@@ -296,6 +310,14 @@ protected:
 
     GlobalSparsityPattern _sparsity_pattern;
 
+    /// Rows of the process variables in the global matrix, empty for a single
+    /// variable or the staggered scheme.
+    std::vector<MathLib::FieldSplit> _field_splits;
+
+    /// Block size of the global matrix if the d.o.f.s of the process
+    /// variables are interleaved, one otherwise.
+    int _matrix_block_size = 1;
+
 protected:
     /// Variables used by this process.  For the monolithic scheme or a
     /// single process, the size of the outer vector is one. For the
@@ -219,6 +219,7 @@ std::unique_ptr<Process> createRichardsMechanicsProcess(
         std::move(named_function_caller), use_monolithic_scheme);
 }
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 template std::unique_ptr<Process> createRichardsMechanicsProcess<2>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -229,7 +230,9 @@ template std::unique_ptr<Process> createRichardsMechanicsProcess<2>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 template std::unique_ptr<Process> createRichardsMechanicsProcess<3>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -240,6 +243,7 @@ template std::unique_ptr<Process> createRichardsMechanicsProcess<3>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
 }  // namespace RichardsMechanics
 }  // namespace ProcessLib
@@ -54,6 +54,7 @@ std::unique_ptr<Process> createRichardsMechanicsProcess(
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 extern template std::unique_ptr<Process> createRichardsMechanicsProcess<2>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -64,7 +65,9 @@ extern template std::unique_ptr<Process> createRichardsMechanicsProcess<2>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 extern template std::unique_ptr<Process> createRichardsMechanicsProcess<3>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -75,5 +78,6 @@ extern template std::unique_ptr<Process> createRichardsMechanicsProcess<3>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 }  // namespace RichardsMechanics
 }  // namespace ProcessLib
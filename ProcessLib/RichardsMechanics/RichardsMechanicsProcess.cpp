@@ -66,7 +66,8 @@ RichardsMechanicsProcess<DisplacementDim>::getMatrixSpecifications(
     {
         auto const& l = *_local_to_global_index_map;
         return {l.dofSizeWithoutGhosts(), l.dofSizeWithoutGhosts(),
-                &l.getGhostIndices(), &this->_sparsity_pattern};
+                &l.getGhostIndices(), &this->_sparsity_pattern,
+                &this->_field_splits, this->_matrix_block_size};
     }
 
     // For staggered scheme and H process (pressure).
@@ -401,8 +402,12 @@ RichardsMechanicsProcess<DisplacementDim>::getDOFTable(
     return *_local_to_global_index_map_with_base_nodes;
 }
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 template class RichardsMechanicsProcess<2>;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 template class RichardsMechanicsProcess<3>;
+#endif
 
 }  // namespace RichardsMechanics
 }  // namespace ProcessLib
@@ -136,8 +136,12 @@ private:
     MeshLib::PropertyVector<double>* _hydraulic_flow = nullptr;
 };
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 extern template class RichardsMechanicsProcess<2>;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 extern template class RichardsMechanicsProcess<3>;
+#endif
 
 }  // namespace RichardsMechanics
 }  // namespace ProcessLib
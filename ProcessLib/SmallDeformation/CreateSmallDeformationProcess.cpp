@@ -137,6 +137,7 @@ std::unique_ptr<Process> createSmallDeformationProcess(
         std::move(named_function_caller));
 }
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 template std::unique_ptr<Process> createSmallDeformationProcess<2>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -147,7 +148,9 @@ template std::unique_ptr<Process> createSmallDeformationProcess<2>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 template std::unique_ptr<Process> createSmallDeformationProcess<3>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -158,6 +161,7 @@ template std::unique_ptr<Process> createSmallDeformationProcess<3>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
 }  // namespace SmallDeformation
 }  // namespace ProcessLib
@@ -311,8 +311,12 @@ void SmallDeformationProcess<DisplacementDim>::postTimestepConcreteProcess(
     material_forces->copyValues(*_material_forces);
 }
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 template class SmallDeformationProcess<2>;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 template class SmallDeformationProcess<3>;
+#endif
 
 }  // namespace SmallDeformation
 }  // namespace ProcessLib
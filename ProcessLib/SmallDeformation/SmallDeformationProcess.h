@@ -112,8 +112,12 @@ private:
     MeshLib::PropertyVector<double>* _material_forces = nullptr;
 };
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 extern template class SmallDeformationProcess<2>;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 extern template class SmallDeformationProcess<3>;
+#endif
 
 }  // namespace SmallDeformation
 }  // namespace ProcessLib
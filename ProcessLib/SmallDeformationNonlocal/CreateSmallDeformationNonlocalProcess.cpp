@@ -128,6 +128,7 @@ std::unique_ptr<Process> createSmallDeformationNonlocalProcess(
         std::move(named_function_caller));
 }
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 template std::unique_ptr<Process> createSmallDeformationNonlocalProcess<2>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -138,7 +139,9 @@ template std::unique_ptr<Process> createSmallDeformationNonlocalProcess<2>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 template std::unique_ptr<Process> createSmallDeformationNonlocalProcess<3>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -149,6 +152,7 @@ template std::unique_ptr<Process> createSmallDeformationNonlocalProcess<3>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
 }  // namespace SmallDeformationNonlocal
 }  // namespace ProcessLib
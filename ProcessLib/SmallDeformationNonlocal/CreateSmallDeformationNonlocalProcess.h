@@ -51,6 +51,7 @@ std::unique_ptr<Process> createSmallDeformationNonlocalProcess(
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 extern template std::unique_ptr<Process>
 createSmallDeformationNonlocalProcess<2>(
     std::string name,
@@ -62,7 +63,9 @@ createSmallDeformationNonlocalProcess<2>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 extern template std::unique_ptr<Process>
 createSmallDeformationNonlocalProcess<3>(
     std::string name,
@@ -74,6 +77,7 @@ createSmallDeformationNonlocalProcess<3>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
 }  // namespace SmallDeformationNonlocal
 }  // namespace ProcessLib
@@ -15,22 +15,14 @@ namespace ProcessLib
 {
 namespace SmallDeformationNonlocal
 {
-struct IntegrationPointDataNonlocalInterface;
-
-struct NonlocalIP final
-{
-    IntegrationPointDataNonlocalInterface* const ip_l_pointer;
-    double alpha_kl_times_w_l;
-    double distance2;  ///< Squared distance to current integration point.
-};
-
 struct IntegrationPointDataNonlocalInterface
 {
     virtual ~IntegrationPointDataNonlocalInterface() = default;
 
-    std::vector<NonlocalIP> non_local_assemblers;
-
     double kappa_d = 0;      ///< damage driving variable.
+    /// Nonlocal average of kappa_d, computed by the process after the
+    /// preassembly of all elements.
+    double nonlocal_kappa_d = 0;
     double integration_weight;
     double nonlocal_internal_length;
     Eigen::Vector3d coordinates;
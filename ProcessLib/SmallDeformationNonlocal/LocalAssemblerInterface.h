@@ -86,16 +86,6 @@ struct SmallDeformationNonlocalLocalAssemblerInterface
     virtual std::vector<double> const& getNodalValues(
         std::vector<double>& nodal_values) const = 0;
 
-    virtual void nonlocal(
-        std::size_t const mesh_item_id,
-        std::vector<std::unique_ptr<
-            SmallDeformationNonlocalLocalAssemblerInterface>> const&
-            local_assemblers) = 0;
-
-    virtual void getIntegrationPointCoordinates(
-        Eigen::Vector3d const& coords,
-        std::vector<double>& distances) const = 0;
-
     virtual IntegrationPointDataNonlocalInterface* getIPDataPtr(
         int const ip) = 0;
 };
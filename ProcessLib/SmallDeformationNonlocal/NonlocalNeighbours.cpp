@@ -0,0 +1,217 @@
+/**
+ * \file
+ *
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "NonlocalNeighbours.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <utility>
+
+namespace
+{
+/// Uniform grid over the bounding box of a point set. The point indices of
+/// each cell are stored contiguously in ascending order.
+class CellList
+{
+public:
+    CellList(std::vector<Eigen::Vector3d> const& points, double const radius)
+        : _min(points.front()), _cell_size(radius)
+    {
+        Eigen::Vector3d max = points.front();
+        for (auto const& p : points)
+        {
+            _min = _min.cwiseMin(p);
+            max = max.cwiseMax(p);
+        }
+
+        // Limit the number of cells for points spread over a domain much
+        // larger than the radius; larger cells keep the search correct.
+        double const max_n_cells = 8. * points.size() + 1;
+        auto const n_cells_for = [&](double const cell_size) {
+            double n = 1;
+            for (int d = 0; d < 3; ++d)
+            {
+                n *= std::floor((max[d] - _min[d]) / cell_size) + 1;
+            }
+            return n;
+        };
+        while (n_cells_for(_cell_size) > max_n_cells)
+        {
+            _cell_size *= 2;
+        }
+        for (int d = 0; d < 3; ++d)
+        {
+            _dims[d] = static_cast<std::size_t>(
+                           std::floor((max[d] - _min[d]) / _cell_size)) +
+                       1;
+        }
+
+        auto const n_points = static_cast<long long>(points.size());
+        std::vector<std::size_t> cell_ids(points.size());
+#pragma omp parallel for
+        for (long long i = 0; i < n_points; ++i)
+        {
+            cell_ids[i] = cellId(cellCoordinates(points[i]));
+        }
+
+        // Counting sort of the points into the cells keeping the point order.
+        _cell_offsets.assign(_dims[0] * _dims[1] * _dims[2] + 1, 0);
+        for (auto const c : cell_ids)
+        {
+            ++_cell_offsets[c + 1];
+        }
+        std::partial_sum(_cell_offsets.begin(), _cell_offsets.end(),
+                         _cell_offsets.begin());
+        _cell_points.resize(points.size());
+        std::vector<std::size_t> position(_cell_offsets.begin(),
+                                          _cell_offsets.end() - 1);
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            _cell_points[position[cell_ids[i]]++] = i;
+        }
+    }
+
+    /// Calls f for each point in the cell of p and the adjacent cells.
+    template <typename Function>
+    void forEachPointNear(Eigen::Vector3d const& p, Function&& f) const
+    {
+        auto const c = cellCoordinates(p);
+        std::array<std::size_t, 3> begin;
+        std::array<std::size_t, 3> end;
+        for (int d = 0; d < 3; ++d)
+        {
+            begin[d] = c[d] > 0 ? c[d] - 1 : 0;
+            end[d] = std::min(c[d] + 2, _dims[d]);
+        }
+        for (std::size_t k = begin[2]; k < end[2]; ++k)
+        {
+            for (std::size_t j = begin[1]; j < end[1]; ++j)
+            {
+                for (std::size_t i = begin[0]; i < end[0]; ++i)
+                {
+                    auto const cell = cellId({{i, j, k}});
+                    for (auto n = _cell_offsets[cell];
+                         n < _cell_offsets[cell + 1]; ++n)
+                    {
+                        f(_cell_points[n]);
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    std::array<std::size_t, 3> cellCoordinates(Eigen::Vector3d const& p) const
+    {
+        std::array<std::size_t, 3> c;
+        for (int d = 0; d < 3; ++d)
+        {
+            c[d] = std::min(
+                static_cast<std::size_t>((p[d] - _min[d]) / _cell_size),
+                _dims[d] - 1);
+        }
+        return c;
+    }
+
+    std::size_t cellId(std::array<std::size_t, 3> const& c) const
+    {
+        return c[0] + _dims[0] * (c[1] + _dims[1] * c[2]);
+    }
+
+    Eigen::Vector3d _min;
+    double _cell_size;
+    std::array<std::size_t, 3> _dims;
+    std::vector<std::size_t> _cell_offsets;
+    std::vector<std::size_t> _cell_points;
+};
+}  // namespace
+
+namespace ProcessLib
+{
+namespace SmallDeformationNonlocal
+{
+NonlocalNeighbours findNeighboursWithinRadius(
+    std::vector<Eigen::Vector3d> const& points, double const radius_squared,
+    std::function<bool(std::size_t, std::size_t)> const& is_neighbour)
+{
+    NonlocalNeighbours neighbours;
+    neighbours.row_offsets.assign(points.size() + 1, 0);
+    if (points.empty() || !(radius_squared > 0))
+    {
+        return neighbours;
+    }
+
+    CellList const cell_list(points, std::sqrt(radius_squared));
+    auto const n_points = static_cast<long long>(points.size());
+
+    auto const is_neighbour_within_radius = [&](std::size_t const k,
+                                                std::size_t const l,
+                                                double const distance2) {
+        return distance2 < radius_squared &&
+               (!is_neighbour || is_neighbour(k, l));
+    };
+
+    // The first pass counts the neighbours for the allocation of the
+    // compressed rows, the second pass fills them.
+#pragma omp parallel for schedule(dynamic, 64)
+    for (long long k = 0; k < n_points; ++k)
+    {
+        auto const& x_k = points[k];
+        std::size_t count = 0;
+        cell_list.forEachPointNear(x_k, [&](std::size_t const l) {
+            if (is_neighbour_within_radius(k, l,
+                                           (points[l] - x_k).squaredNorm()))
+            {
+                count++;
+            }
+        });
+        neighbours.row_offsets[k + 1] = count;
+    }
+    std::partial_sum(neighbours.row_offsets.begin(),
+                     neighbours.row_offsets.end(),
+                     neighbours.row_offsets.begin());
+    neighbours.columns.resize(neighbours.row_offsets.back());
+    neighbours.values.resize(neighbours.row_offsets.back());
+
+#pragma omp parallel
+    {
+        std::vector<std::pair<std::size_t, double>> row;
+#pragma omp for schedule(dynamic, 64)
+        for (long long k = 0; k < n_points; ++k)
+        {
+            auto const& x_k = points[k];
+            row.clear();
+            cell_list.forEachPointNear(x_k, [&](std::size_t const l) {
+                double const distance2 = (points[l] - x_k).squaredNorm();
+                if (is_neighbour_within_radius(k, l, distance2))
+                {
+                    row.emplace_back(l, distance2);
+                }
+            });
+            std::sort(row.begin(), row.end());
+
+            auto position = neighbours.row_offsets[k];
+            for (auto const& entry : row)
+            {
+                neighbours.columns[position] = entry.first;
+                neighbours.values[position] = entry.second;
+                position++;
+            }
+        }
+    }
+
+    return neighbours;
+}
+
+}  // namespace SmallDeformationNonlocal
+}  // namespace ProcessLib
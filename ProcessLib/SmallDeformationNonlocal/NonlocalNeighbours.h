@@ -0,0 +1,53 @@
+/**
+ * \file
+ *
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include <Eigen/Eigen>
+
+namespace ProcessLib
+{
+namespace SmallDeformationNonlocal
+{
+/// Neighbourhood relation of points stored in the compressed sparse row
+/// format. The neighbours of the k-th point are the entries
+/// [row_offsets[k], row_offsets[k+1]) of the columns and values arrays sorted
+/// by ascending point index.
+struct NonlocalNeighbours
+{
+    std::vector<std::size_t> row_offsets;
+    std::vector<std::size_t> columns;
+    std::vector<double> values;
+};
+
+/// Finds for each of the given points all points \f$l\f$ with squared
+/// distance \f$|x_k - x_l|^2\f$ less than \c radius_squared; the point itself
+/// is included. The squared distances are stored as values.
+///
+/// If given, \c is_neighbour(k, l) further restricts the points found by
+/// distance, e.g. to the points of connected elements. The relation is then
+/// not necessarily symmetric.
+///
+/// The points are sorted into a uniform grid (cell list) with a cell size not
+/// smaller than the radius, such that only the adjacent cells of a point have
+/// to be searched. Both the grid and the neighbour lists are built in
+/// parallel.
+NonlocalNeighbours findNeighboursWithinRadius(
+    std::vector<Eigen::Vector3d> const& points, double radius_squared,
+    std::function<bool(std::size_t, std::size_t)> const& is_neighbour =
+        nullptr);
+
+}  // namespace SmallDeformationNonlocal
+}  // namespace ProcessLib
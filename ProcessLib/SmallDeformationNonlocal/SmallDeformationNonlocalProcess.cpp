@@ -12,8 +12,11 @@
 #include "SmallDeformationNonlocalProcess.h"
 
 #include <nlohmann/json.hpp>
+#include <algorithm>
 #include <iostream>
 
+#include "MeshLib/findElementsWithinRadius.h"
+
 // Reusing local assembler creation code.
 #include "ProcessLib/SmallDeformation/CreateLocalAssemblers.h"
 
@@ -138,9 +141,7 @@ void SmallDeformationNonlocalProcess<DisplacementDim>::
         makeExtrapolator(1, getExtrapolator(), _local_assemblers,
                          &LocalAssemblerInterface::getIntPtDamage));
 
-    GlobalExecutor::executeMemberOnDereferenced(
-        &LocalAssemblerInterface::nonlocal, _local_assemblers,
-        _local_assemblers);
+    initializeNonlocalNeighbours();
 
     // Set initial conditions for integration point data.
     for (auto const& ip_writer : _integration_point_writer)
@@ -222,6 +223,139 @@ void SmallDeformationNonlocalProcess<DisplacementDim>::
     }
 }
 
+template <int DisplacementDim>
+void SmallDeformationNonlocalProcess<
+    DisplacementDim>::initializeNonlocalNeighbours()
+{
+    std::vector<std::size_t> ip_element_ids;
+    for (std::size_t e = 0; e < _local_assemblers.size(); e++)
+    {
+        auto const& local_asm = _local_assemblers[e];
+        unsigned const n_integration_points =
+            local_asm->getNumberOfIntegrationPoints();
+        for (unsigned ip = 0; ip < n_integration_points; ip++)
+        {
+            _integration_points.push_back(local_asm->getIPDataPtr(ip));
+            ip_element_ids.push_back(e);
+        }
+    }
+
+    std::vector<Eigen::Vector3d> coordinates;
+    coordinates.reserve(_integration_points.size());
+    for (auto const* ip_data : _integration_points)
+    {
+        coordinates.push_back(ip_data->coordinates);
+    }
+
+    double const internal_length2 = _process_data.internal_length_squared;
+
+    // Only the integration points of elements connected to the element of the
+    // k-th integration point within the internal length are its neighbours.
+    // Points close by distance but across a gap, e.g. a notch, are excluded.
+    auto const& elements = _mesh.getElements();
+    std::vector<std::vector<std::size_t>> search_element_ids(elements.size());
+    auto const n_elements = static_cast<long long>(elements.size());
+#pragma omp parallel for schedule(dynamic, 64)
+    for (long long e = 0; e < n_elements; ++e)
+    {
+        // The element ids are returned sorted.
+        search_element_ids[e] =
+            MeshLib::findElementsWithinRadius(*elements[e], internal_length2);
+    }
+    auto const is_in_connected_element = [&](std::size_t const k,
+                                             std::size_t const l) {
+        auto const& ids = search_element_ids[ip_element_ids[k]];
+        return std::binary_search(ids.begin(), ids.end(), ip_element_ids[l]);
+    };
+
+    _nonlocal_neighbours = findNeighboursWithinRadius(
+        coordinates, internal_length2, is_in_connected_element);
+
+    auto const& offsets = _nonlocal_neighbours.row_offsets;
+    for (std::size_t k = 0; k < _integration_points.size(); ++k)
+    {
+        if (offsets[k] == offsets[k + 1])
+        {
+            OGS_FATAL("no neighbours found!");
+        }
+    }
+
+    auto const& columns = _nonlocal_neighbours.columns;
+    auto& values = _nonlocal_neighbours.values;
+    auto alpha_0 = [internal_length2](double const distance2) {
+        return (distance2 > internal_length2)
+                   ? 0
+                   : (1 - distance2 / (internal_length2)) *
+                         (1 - distance2 / (internal_length2));
+    };
+
+    //
+    // Replace the squared distances by
+    //   alpha_kl = alpha_0(|x_k - x_l|) / int_{m \in ip} alpha_0(|x_k - x_m|)
+    // already multiplied with the integration weight of the l integration
+    // point.
+    //
+    auto const n_integration_points =
+        static_cast<long long>(_integration_points.size());
+#pragma omp parallel for
+    for (long long k = 0; k < n_integration_points; ++k)
+    {
+        double a_k_sum_m = 0;
+        for (auto i = offsets[k]; i < offsets[k + 1]; ++i)
+        {
+            auto const w_m = _integration_points[columns[i]]->integration_weight;
+            a_k_sum_m += w_m * alpha_0(values[i]);
+        }
+        for (auto i = offsets[k]; i < offsets[k + 1]; ++i)
+        {
+            auto const w_l = _integration_points[columns[i]]->integration_weight;
+            values[i] = alpha_0(values[i]) / a_k_sum_m * w_l;
+        }
+    }
+
+    INFO("Found %d nonlocal neighbours for %d integration points.",
+         columns.size(), _integration_points.size());
+}
+
+template <int DisplacementDim>
+void SmallDeformationNonlocalProcess<DisplacementDim>::computeNonlocalKappaD()
+{
+    auto const& offsets = _nonlocal_neighbours.row_offsets;
+    auto const& columns = _nonlocal_neighbours.columns;
+    auto const& values = _nonlocal_neighbours.values;
+
+    // The neighbours of a damaged integration point are activated. The
+    // neighbourhood relation is not symmetric, so this is done serially
+    // before the parallel averaging.
+    for (std::size_t k = 0; k < _integration_points.size(); ++k)
+    {
+        if (!_integration_points[k]->active_self)
+        {
+            continue;
+        }
+        for (auto i = offsets[k]; i < offsets[k + 1]; ++i)
+        {
+            _integration_points[columns[i]]->activated = true;
+        }
+    }
+
+    auto const n_integration_points =
+        static_cast<long long>(_integration_points.size());
+#pragma omp parallel for
+    for (long long k = 0; k < n_integration_points; ++k)
+    {
+        auto& ip_k = *_integration_points[k];
+        double nonlocal_kappa_d = 0;
+        for (auto i = offsets[k]; i < offsets[k + 1]; ++i)
+        {
+            nonlocal_kappa_d +=
+                values[i] * _integration_points[columns[i]]->kappa_d;
+        }
+        ip_k.nonlocal_kappa_d =
+            (ip_k.active_self || ip_k.activated) ? nonlocal_kappa_d : 0;
+    }
+}
+
 template <int DisplacementDim>
 void SmallDeformationNonlocalProcess<DisplacementDim>::assembleConcreteProcess(
     const double t, GlobalVector const& x, GlobalMatrix& M, GlobalMatrix& K,
@@ -256,6 +390,8 @@ void SmallDeformationNonlocalProcess<
         _global_assembler, &VectorMatrixAssembler::preAssemble,
         _local_assemblers, pv.getActiveElementIDs(),
         *_local_to_global_index_map, t, x);
+
+    computeNonlocalKappaD();
 }
 
 template <int DisplacementDim>
@@ -329,8 +465,12 @@ SmallDeformationNonlocalProcess<DisplacementDim>::postIterationConcreteProcess(
     return NumLib::IterationResult::SUCCESS;
 }
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 template class SmallDeformationNonlocalProcess<2>;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 template class SmallDeformationNonlocalProcess<3>;
+#endif
 
 }  // namespace SmallDeformationNonlocal
 }  // namespace ProcessLib
@@ -18,6 +18,7 @@
 #include "ProcessLib/Process.h"
 
 #include "IntegrationPointWriter.h"
+#include "NonlocalNeighbours.h"
 #include "SmallDeformationNonlocalFEM.h"
 #include "SmallDeformationNonlocalProcessData.h"
 
@@ -74,6 +75,14 @@ private:
     NumLib::IterationResult postIterationConcreteProcess(
         GlobalVector const& x) override;
 
+    /// Finds the neighbours of all integration points within the internal
+    /// length and computes the weights of the nonlocal averaging.
+    void initializeNonlocalNeighbours();
+
+    /// Computes the nonlocal kappa_d of all integration points from the local
+    /// values and activates the neighbours of the damaged integration points.
+    void computeNonlocalKappaD();
+
 private:
     SmallDeformationNonlocalProcessData<DisplacementDim> _process_data;
 
@@ -85,12 +94,23 @@ private:
         _local_to_global_index_map_single_component;
 
     MeshLib::PropertyVector<double>* _nodal_forces = nullptr;
+
+    /// The integration points of all local assemblers in the order of the
+    /// elements.
+    std::vector<IntegrationPointDataNonlocalInterface*> _integration_points;
+    /// Neighbours of the integration points with the weights
+    /// \f$\alpha_{kl} w_l\f$ of the nonlocal averaging as values.
+    NonlocalNeighbours _nonlocal_neighbours;
 };
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 extern template class ProcessLib::SmallDeformationNonlocal::
     SmallDeformationNonlocalProcess<2>;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 extern template class ProcessLib::SmallDeformationNonlocal::
     SmallDeformationNonlocalProcess<3>;
+#endif
 
 }  // namespace SmallDeformationNonlocal
 }  // namespace ProcessLib
@@ -296,6 +296,7 @@ std::unique_ptr<Process> createThermoHydroMechanicsProcess(
         std::move(named_function_caller), use_monolithic_scheme);
 }
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 template std::unique_ptr<Process> createThermoHydroMechanicsProcess<2>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -306,7 +307,9 @@ template std::unique_ptr<Process> createThermoHydroMechanicsProcess<2>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 template std::unique_ptr<Process> createThermoHydroMechanicsProcess<3>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -317,6 +320,7 @@ template std::unique_ptr<Process> createThermoHydroMechanicsProcess<3>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
 }  // namespace ThermoHydroMechanics
 }  // namespace ProcessLib
@@ -50,6 +50,7 @@ std::unique_ptr<Process> createThermoHydroMechanicsProcess(
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 extern template std::unique_ptr<Process> createThermoHydroMechanicsProcess<2>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -60,7 +61,9 @@ extern template std::unique_ptr<Process> createThermoHydroMechanicsProcess<2>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 extern template std::unique_ptr<Process> createThermoHydroMechanicsProcess<3>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -71,5 +74,6 @@ extern template std::unique_ptr<Process> createThermoHydroMechanicsProcess<3>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 }  // namespace ThermoHydroMechanics
 }  // namespace ProcessLib
@@ -67,7 +67,8 @@ ThermoHydroMechanicsProcess<DisplacementDim>::getMatrixSpecifications(
     {
         auto const& l = *_local_to_global_index_map;
         return {l.dofSizeWithoutGhosts(), l.dofSizeWithoutGhosts(),
-                &l.getGhostIndices(), &this->_sparsity_pattern};
+                &l.getGhostIndices(), &this->_sparsity_pattern,
+                &this->_field_splits, this->_matrix_block_size};
     }
 
     // For staggered scheme and T or H process (pressure).
@@ -408,8 +409,12 @@ ThermoHydroMechanicsProcess<DisplacementDim>::getDOFTable(
     return *_local_to_global_index_map_with_base_nodes;
 }
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 template class ThermoHydroMechanicsProcess<2>;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 template class ThermoHydroMechanicsProcess<3>;
+#endif
 
 }  // namespace ThermoHydroMechanics
 }  // namespace ProcessLib
@@ -141,8 +141,12 @@ private:
     MeshLib::PropertyVector<double>* _hydraulic_flow = nullptr;
 };
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 extern template class ThermoHydroMechanicsProcess<2>;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 extern template class ThermoHydroMechanicsProcess<3>;
+#endif
 
 }  // namespace ThermoHydroMechanics
 }  // namespace ProcessLib
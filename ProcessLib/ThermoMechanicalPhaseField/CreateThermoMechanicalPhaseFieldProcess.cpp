@@ -246,6 +246,7 @@ std::unique_ptr<Process> createThermoMechanicalPhaseFieldProcess(
         phase_field_process_id, heat_conduction_process_id);
 }
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 template std::unique_ptr<Process> createThermoMechanicalPhaseFieldProcess<2>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -256,7 +257,9 @@ template std::unique_ptr<Process> createThermoMechanicalPhaseFieldProcess<2>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 template std::unique_ptr<Process> createThermoMechanicalPhaseFieldProcess<3>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -267,6 +270,7 @@ template std::unique_ptr<Process> createThermoMechanicalPhaseFieldProcess<3>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
 }  // namespace ThermoMechanicalPhaseField
 }  // namespace ProcessLib
@@ -49,6 +49,7 @@ std::unique_ptr<Process> createThermoMechanicalPhaseFieldProcess(
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 extern template std::unique_ptr<Process>
 createThermoMechanicalPhaseFieldProcess<2>(
     std::string name,
@@ -60,7 +61,9 @@ createThermoMechanicalPhaseFieldProcess<2>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 extern template std::unique_ptr<Process>
 createThermoMechanicalPhaseFieldProcess<3>(
     std::string name,
@@ -72,6 +75,7 @@ createThermoMechanicalPhaseFieldProcess<3>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
 }  // namespace ThermoMechanicalPhaseField
 }  // namespace ProcessLib
@@ -335,8 +335,12 @@ void ThermoMechanicalPhaseFieldProcess<
         use_monolithic_scheme);
 }
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 template class ThermoMechanicalPhaseFieldProcess<2>;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 template class ThermoMechanicalPhaseFieldProcess<3>;
+#endif
 
 }  // namespace ThermoMechanicalPhaseField
 }  // namespace ProcessLib
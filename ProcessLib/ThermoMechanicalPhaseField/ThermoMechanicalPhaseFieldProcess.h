@@ -140,8 +140,12 @@ private:
     int const _heat_conduction_process_id;
 };
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 extern template class ThermoMechanicalPhaseFieldProcess<2>;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 extern template class ThermoMechanicalPhaseFieldProcess<3>;
+#endif
 
 }  // namespace ThermoMechanicalPhaseField
 }  // namespace ProcessLib
@@ -203,6 +203,7 @@ std::unique_ptr<Process> createThermoMechanicsProcess(
         std::move(named_function_caller), use_monolithic_scheme);
 }
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 template std::unique_ptr<Process> createThermoMechanicsProcess<2>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -213,7 +214,9 @@ template std::unique_ptr<Process> createThermoMechanicsProcess<2>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 template std::unique_ptr<Process> createThermoMechanicsProcess<3>(
     std::string name,
     MeshLib::Mesh& mesh,
@@ -224,6 +227,7 @@ template std::unique_ptr<Process> createThermoMechanicsProcess<3>(
         local_coordinate_system,
     unsigned const integration_order,
     BaseLib::ConfigTree const& config);
+#endif
 
 }  // namespace ThermoMechanics
 }  // namespace ProcessLib
@@ -126,7 +126,8 @@ ThermoMechanicsProcess<DisplacementDim>::getMatrixSpecifications(
     {
         auto const& l = *_local_to_global_index_map;
         return {l.dofSizeWithoutGhosts(), l.dofSizeWithoutGhosts(),
-                &l.getGhostIndices(), &this->_sparsity_pattern};
+                &l.getGhostIndices(), &this->_sparsity_pattern,
+                &this->_field_splits, this->_matrix_block_size};
     }
 
     // For staggered scheme and T process.
@@ -492,8 +493,12 @@ ThermoMechanicsProcess<DisplacementDim>::getDOFTable(const int process_id) const
     return *_local_to_global_index_map_single_component;
 }
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 template class ThermoMechanicsProcess<2>;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 template class ThermoMechanicsProcess<3>;
+#endif
 
 }  // namespace ThermoMechanics
 }  // namespace ProcessLib
@@ -147,8 +147,12 @@ private:
     void setCoupledSolutionsOfPreviousTimeStep();
 };
 
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
 extern template class ThermoMechanicsProcess<2>;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
 extern template class ThermoMechanicsProcess<3>;
+#endif
 
 }  // namespace ThermoMechanics
 }  // namespace ProcessLib
@@ -78,24 +78,34 @@ void createLocalAssemblers(
 
     switch (dimension)
     {
+#ifdef OGS_ENABLE_GLOBAL_DIM_1
         case 1:
             detail::createLocalAssemblers<1, LocalAssemblerImplementation>(
                 dof_table, shapefunction_order, mesh_elements, local_assemblers,
                 std::forward<ExtraCtorArgs>(extra_ctor_args)...);
             break;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_2
         case 2:
             detail::createLocalAssemblers<2, LocalAssemblerImplementation>(
                 dof_table, shapefunction_order, mesh_elements, local_assemblers,
                 std::forward<ExtraCtorArgs>(extra_ctor_args)...);
             break;
+#endif
+#ifdef OGS_ENABLE_GLOBAL_DIM_3
         case 3:
             detail::createLocalAssemblers<3, LocalAssemblerImplementation>(
                 dof_table, shapefunction_order, mesh_elements, local_assemblers,
                 std::forward<ExtraCtorArgs>(extra_ctor_args)...);
             break;
+#endif
         default:
             OGS_FATAL(
-                "Meshes with dimension greater than three are not supported.");
+                "Local assemblers for meshes of dimension %d are not available. "
+                "Only dimensions up to three are supported, and the build "
+                "configuration (OGS_MIN_GLOBAL_DIM, OGS_MAX_ELEMENT_DIM) may "
+                "restrict them further.",
+                dimension);
     }
 }
 
@@ -12,6 +12,8 @@
 #include <cassert>
 #include <functional>  // for std::reference_wrapper.
 
+#include "BaseLib/RunTime.h"
+#include "MeshLib/PropertyVector.h"
 #include "NumLib/DOF/DOFTableUtil.h"
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
 #include "LocalAssemblerInterface.h"
@@ -19,6 +21,38 @@
 #include "CoupledSolutionsForStaggeredScheme.h"
 #include "Process.h"
 
+namespace
+{
+//! Adds the wall-clock time elapsed during its lifetime to the assembly cost
+//! of the mesh item, if the costs are recorded.
+class AssemblyCostRecorder final
+{
+public:
+    AssemblyCostRecorder(MeshLib::PropertyVector<double>* const assembly_costs,
+                         std::size_t const mesh_item_id)
+        : _assembly_costs(assembly_costs), _mesh_item_id(mesh_item_id)
+    {
+        if (_assembly_costs)
+        {
+            _timer.start();
+        }
+    }
+
+    ~AssemblyCostRecorder()
+    {
+        if (_assembly_costs)
+        {
+            (*_assembly_costs)[_mesh_item_id] += _timer.elapsed();
+        }
+    }
+
+private:
+    MeshLib::PropertyVector<double>* const _assembly_costs;
+    std::size_t const _mesh_item_id;
+    BaseLib::RunTime _timer;
+};
+}  // namespace
+
 namespace ProcessLib
 {
 VectorMatrixAssembler::VectorMatrixAssembler(
@@ -45,6 +79,8 @@ void VectorMatrixAssembler::assemble(
     const double t, const GlobalVector& x, GlobalMatrix& M, GlobalMatrix& K,
     GlobalVector& b, CoupledSolutionsForStaggeredScheme const* const cpl_xs)
 {
+    AssemblyCostRecorder const cost_recorder(_assembly_costs, mesh_item_id);
+
     std::vector<std::vector<GlobalIndexType>> indices_of_processes;
     indices_of_processes.reserve(dof_tables.size());
     for (auto dof_table : dof_tables)
@@ -112,6 +148,8 @@ void VectorMatrixAssembler::assembleWithJacobian(
     GlobalVector& b, GlobalMatrix& Jac,
     CoupledSolutionsForStaggeredScheme const* const cpl_xs)
 {
+    AssemblyCostRecorder const cost_recorder(_assembly_costs, mesh_item_id);
+
     std::vector<std::vector<GlobalIndexType>> indices_of_processes;
     indices_of_processes.reserve(dof_tables.size());
     for (auto dof_table : dof_tables)
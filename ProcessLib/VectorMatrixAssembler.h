@@ -14,6 +14,12 @@
 #include "AbstractJacobianAssembler.h"
 #include "CoupledSolutionsForStaggeredScheme.h"
 
+namespace MeshLib
+{
+template <typename PROP_VAL_TYPE>
+class PropertyVector;
+}  // MeshLib
+
 namespace NumLib
 {
 class LocalToGlobalIndexMap;
@@ -63,6 +69,16 @@ public:
         GlobalMatrix& K, GlobalVector& b, GlobalMatrix& Jac,
         CoupledSolutionsForStaggeredScheme const* const cpl_xs);
 
+    //! Enables the recording of the assembly costs: the wall-clock time spent
+    //! in assemble() and assembleWithJacobian() is added to the value of the
+    //! mesh item in \c assembly_costs.
+    void recordAssemblyCosts(MeshLib::PropertyVector<double>* assembly_costs)
+    {
+        _assembly_costs = assembly_costs;
+    }
+
+    bool isRecordingAssemblyCosts() const { return _assembly_costs != nullptr; }
+
 private:
     // temporary data only stored here in order to avoid frequent memory
     // reallocations.
@@ -73,6 +89,9 @@ private:
 
     //! Used to assemble the Jacobian.
     std::unique_ptr<AbstractJacobianAssembler> _jacobian_assembler;
+
+    //! Accumulated assembly time per mesh item; not recorded if null.
+    MeshLib::PropertyVector<double>* _assembly_costs = nullptr;
 };
 
 }  // namespace ProcessLib
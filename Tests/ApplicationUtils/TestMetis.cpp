@@ -0,0 +1,80 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "Applications/Utils/ModelPreparation/PartitionMesh/Metis.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+
+TEST(ApplicationUtilsMetis, NodeWeightsAreScaled)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateLineMesh(3u, 1.0));
+
+    // The node costs are 0, 0.5, 1.5 and 1; the most expensive node gets the
+    // weight 1001 and every node at least the weight 1.
+    auto const weights = ApplicationUtils::computeNodeWeights(
+        mesh->getElements(), mesh->getNumberOfNodes(), {0.0, 1.0, 2.0});
+
+    ASSERT_EQ(4u, weights.size());
+    EXPECT_EQ(1u, weights[0]);
+    EXPECT_EQ(334u, weights[1]);
+    EXPECT_EQ(1001u, weights[2]);
+    EXPECT_EQ(667u, weights[3]);
+}
+
+TEST(ApplicationUtilsMetis, ZeroElementWeightsGiveUnitNodeWeights)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateLineMesh(3u, 1.0));
+
+    auto const weights = ApplicationUtils::computeNodeWeights(
+        mesh->getElements(), mesh->getNumberOfNodes(), {0.0, 0.0, 0.0});
+
+    EXPECT_EQ(std::vector<std::size_t>(4, 1), weights);
+}
+
+TEST(ApplicationUtilsMetis, ElementWeightsShiftPartitionSizes)
+{
+    std::size_t const n_elements = 20;
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateLineMesh(
+            static_cast<unsigned>(n_elements), 1.0));
+    auto const& elements = mesh->getElements();
+    auto const n_nodes = mesh->getNumberOfNodes();
+
+    auto count_nodes_with_partition_of_first_node =
+        [](std::vector<std::size_t> const& partition_ids) {
+            return std::count(partition_ids.begin(), partition_ids.end(),
+                              partition_ids.front());
+        };
+
+    auto const equal_partition_ids =
+        ApplicationUtils::computePartitionIDsWithMETIS(elements, n_nodes, 2);
+    ASSERT_EQ(n_nodes, equal_partition_ids.size());
+    EXPECT_LE(9, count_nodes_with_partition_of_first_node(equal_partition_ids));
+    EXPECT_GE(12,
+              count_nodes_with_partition_of_first_node(equal_partition_ids));
+
+    // The first five elements are a hundred times as expensive as the others,
+    // so the partition containing them gets considerably fewer nodes.
+    std::vector<double> element_weights(n_elements, 1.0);
+    std::fill_n(element_weights.begin(), 5, 100.0);
+    auto const weighted_partition_ids =
+        ApplicationUtils::computePartitionIDsWithMETIS(elements, n_nodes, 2,
+                                                       &element_weights);
+    ASSERT_EQ(n_nodes, weighted_partition_ids.size());
+    EXPECT_GE(6,
+              count_nodes_with_partition_of_first_node(weighted_partition_ids));
+}
@@ -0,0 +1,99 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "Applications/FileIO/AsciiRasterInterface.h"
+#include "BaseLib/BuildInfo.h"
+#include "BaseLib/FileTools.h"
+#include "GeoLib/Raster.h"
+
+class AsciiRasterInterfaceTest : public ::testing::Test
+{
+public:
+    AsciiRasterInterfaceTest()
+    {
+        std::ofstream out(file_name);
+        out << "ncols 3\n"
+            << "nrows 2\n"
+            << "xllcorner 10\n"
+            << "yllcorner 20,5\n"
+            << "cellsize 2\n"
+            << "NODATA_value -9999\n"
+            // Top row first; decimal commas are accepted.
+            << "1 2,5 3\n"
+            << "4 -9999 6e1\n";
+    }
+
+    ~AsciiRasterInterfaceTest() override
+    {
+        std::remove(file_name.c_str());
+        std::remove((file_name + ".bin").c_str());
+    }
+
+    void checkRaster(GeoLib::Raster const& raster) const
+    {
+        auto const& header = raster.getHeader();
+        ASSERT_EQ(3u, header.n_cols);
+        ASSERT_EQ(2u, header.n_rows);
+        EXPECT_EQ(10.0, header.origin[0]);
+        EXPECT_EQ(20.5, header.origin[1]);
+        EXPECT_EQ(2.0, header.cell_size);
+        EXPECT_EQ(-9999.0, header.no_data);
+
+        // The bottom row is stored first.
+        std::vector<double> const expected{4, -9999, 60, 1, 2.5, 3};
+        ASSERT_EQ(expected,
+                  std::vector<double>(raster.begin(), raster.end()));
+
+        EXPECT_EQ(2.5, raster.getValueAtPoint(MathLib::Point3d{
+                           {{12.5, 23.0, 0.0}}}));
+    }
+
+    std::string const file_name =
+        BaseLib::BuildInfo::tests_tmp_path + "AsciiRasterInterfaceTest.asc";
+};
+
+TEST_F(AsciiRasterInterfaceTest, ReadASCFile)
+{
+    std::unique_ptr<GeoLib::Raster> raster(
+        FileIO::AsciiRasterInterface::readRaster(file_name));
+    ASSERT_TRUE(raster != nullptr);
+    checkRaster(*raster);
+    EXPECT_FALSE(BaseLib::IsFileExisting(file_name + ".bin"));
+}
+
+TEST_F(AsciiRasterInterfaceTest, ReadASCFileWithBinaryCache)
+{
+    {
+        // Creates the binary copy.
+        std::unique_ptr<GeoLib::Raster> raster(
+            FileIO::AsciiRasterInterface::readRaster(file_name, true));
+        ASSERT_TRUE(raster != nullptr);
+        checkRaster(*raster);
+    }
+    ASSERT_TRUE(BaseLib::IsFileExisting(file_name + ".bin"));
+
+    // Reads from the binary copy.
+    std::unique_ptr<GeoLib::Raster> raster(
+        FileIO::AsciiRasterInterface::readRaster(file_name, true));
+    ASSERT_TRUE(raster != nullptr);
+    checkRaster(*raster);
+
+    // Refinement copies the memory mapped values.
+    raster->refineRaster(2);
+    ASSERT_EQ(24, raster->end() - raster->begin());
+    EXPECT_EQ(60.0, *(raster->begin() + 5));
+}
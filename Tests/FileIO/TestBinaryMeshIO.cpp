@@ -0,0 +1,147 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "BaseLib/BuildInfo.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/IO/BinaryIO/BinaryMeshIO.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshGenerators/QuadraticMeshGenerator.h"
+#include "MeshLib/Node.h"
+
+class BinaryMeshIOTest : public ::testing::Test
+{
+public:
+    ~BinaryMeshIOTest() override { std::remove(file_name.c_str()); }
+
+    static void checkEqualMeshes(MeshLib::Mesh const& expected,
+                                 MeshLib::Mesh const& mesh)
+    {
+        ASSERT_EQ(expected.getNumberOfNodes(), mesh.getNumberOfNodes());
+        ASSERT_EQ(expected.getNumberOfElements(), mesh.getNumberOfElements());
+        for (std::size_t i = 0; i < mesh.getNumberOfNodes(); ++i)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                EXPECT_EQ((*expected.getNode(i))[c], (*mesh.getNode(i))[c]);
+            }
+        }
+        for (std::size_t e = 0; e < mesh.getNumberOfElements(); ++e)
+        {
+            auto const& expected_element = *expected.getElement(e);
+            auto const& element = *mesh.getElement(e);
+            ASSERT_EQ(expected_element.getCellType(), element.getCellType());
+            for (unsigned k = 0; k < element.getNumberOfNodes(); ++k)
+            {
+                EXPECT_EQ(expected_element.getNodeIndex(k),
+                          element.getNodeIndex(k));
+            }
+        }
+    }
+
+protected:
+    std::string const file_name =
+        BaseLib::BuildInfo::tests_tmp_path + "BinaryMeshIOTest.bmsh";
+};
+
+TEST_F(BinaryMeshIOTest, WriteAndReadMeshWithProperties)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularPrismMesh(1.0, 2.0, 3.0, 3, 2,
+                                                         4));
+    auto& properties = mesh->getProperties();
+    auto* const material_ids = properties.createNewPropertyVector<int>(
+        "MaterialIDs", MeshLib::MeshItemType::Cell, 1);
+    for (std::size_t e = 0; e < mesh->getNumberOfElements(); ++e)
+    {
+        material_ids->push_back(static_cast<int>(e % 3));
+    }
+    auto* const velocity = properties.createNewPropertyVector<double>(
+        "velocity", MeshLib::MeshItemType::Node, 3);
+    for (std::size_t i = 0; i < 3 * mesh->getNumberOfNodes(); ++i)
+    {
+        velocity->push_back(0.5 * i);
+    }
+    auto* const flags = properties.createNewPropertyVector<char>(
+        "flags", MeshLib::MeshItemType::Node, 1);
+    for (std::size_t i = 0; i < mesh->getNumberOfNodes(); ++i)
+    {
+        flags->push_back(static_cast<char>(i % 2));
+    }
+
+    ASSERT_TRUE(MeshLib::IO::writeBinaryMesh(*mesh, file_name));
+    std::unique_ptr<MeshLib::Mesh> const read_mesh(
+        MeshLib::IO::readBinaryMesh(file_name));
+    ASSERT_TRUE(read_mesh != nullptr);
+
+    EXPECT_EQ("BinaryMeshIOTest", read_mesh->getName());
+    checkEqualMeshes(*mesh, *read_mesh);
+
+    auto const& read_properties = read_mesh->getProperties();
+    ASSERT_TRUE(read_properties.existsPropertyVector<int>(
+        "MaterialIDs", MeshLib::MeshItemType::Cell, 1));
+    EXPECT_EQ(
+        static_cast<std::vector<int> const&>(*material_ids),
+        static_cast<std::vector<int> const&>(
+            *read_properties.getPropertyVector<int>("MaterialIDs")));
+    ASSERT_TRUE(read_properties.existsPropertyVector<double>(
+        "velocity", MeshLib::MeshItemType::Node, 3));
+    EXPECT_EQ(static_cast<std::vector<double> const&>(*velocity),
+              static_cast<std::vector<double> const&>(
+                  *read_properties.getPropertyVector<double>("velocity")));
+    ASSERT_TRUE(read_properties.existsPropertyVector<char>(
+        "flags", MeshLib::MeshItemType::Node, 1));
+    EXPECT_EQ(static_cast<std::vector<char> const&>(*flags),
+              static_cast<std::vector<char> const&>(
+                  *read_properties.getPropertyVector<char>("flags")));
+}
+
+TEST_F(BinaryMeshIOTest, WriteAndReadQuadraticMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> linear_mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 4));
+    auto const mesh = MeshLib::createQuadraticOrderMesh(*linear_mesh);
+    ASSERT_TRUE(MeshLib::IO::writeBinaryMesh(*mesh, file_name));
+    std::unique_ptr<MeshLib::Mesh> const read_mesh(
+        MeshLib::IO::readBinaryMesh(file_name));
+    ASSERT_TRUE(read_mesh != nullptr);
+    checkEqualMeshes(*mesh, *read_mesh);
+}
+
+TEST_F(BinaryMeshIOTest, RejectTruncatedFile)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 3));
+    ASSERT_TRUE(MeshLib::IO::writeBinaryMesh(*mesh, file_name));
+
+    // keep only the header and the node coordinates
+    std::vector<char> contents;
+    {
+        std::ifstream in(file_name, std::ios::binary);
+        contents.assign(std::istreambuf_iterator<char>(in),
+                        std::istreambuf_iterator<char>());
+    }
+    std::size_t const header_size = 8 * 8;
+    {
+        std::ofstream out(file_name, std::ios::binary | std::ios::trunc);
+        out.write(contents.data(),
+                  header_size + 3 * sizeof(double) * mesh->getNumberOfNodes());
+    }
+
+    EXPECT_EQ(nullptr, MeshLib::IO::readBinaryMesh(file_name));
+}
@@ -10,6 +10,7 @@
  */
 
 #include <ctime>
+#include <random>
 #include <tuple>
 
 #include "gtest/gtest.h"
@@ -112,3 +113,120 @@ TEST(GeoLib, TestComputeAndInsertAllIntersectionPoints)
     delete ply0;
 }
 
+
+// Reference implementation checking all pairs of polylines and segments.
+static void computeAndInsertAllIntersectionPointsBruteForce(
+    GeoLib::PointVec& pnt_vec, std::vector<GeoLib::Polyline*>& plys)
+{
+    for (auto it0(plys.begin()); it0 != plys.end(); ++it0)
+    {
+        for (auto it1(std::next(it0)); it1 != plys.end(); ++it1)
+        {
+            auto& poly0 = **it0;
+            auto& poly1 = **it1;
+            for (auto seg0_it(poly0.begin()); seg0_it != poly0.end(); ++seg0_it)
+            {
+                for (auto seg1_it(poly1.begin()); seg1_it != poly1.end();
+                     ++seg1_it)
+                {
+                    GeoLib::Point s(0.0, 0.0, 0.0, pnt_vec.size());
+                    if (GeoLib::lineSegmentIntersect(*seg0_it, *seg1_it, s))
+                    {
+                        std::size_t const id(
+                            pnt_vec.push_back(new GeoLib::Point(s)));
+                        poly0.insertPoint(seg0_it.getSegmentNumber() + 1, id);
+                        poly1.insertPoint(seg1_it.getSegmentNumber() + 1, id);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(GeoLib, TestComputeAndInsertAllIntersectionPointsRandomPolylines)
+{
+    std::mt19937 random_engine(42);
+    std::uniform_real_distribution<double> coordinate(0.0, 100.0);
+    std::uniform_real_distribution<double> step(-5.0, 5.0);
+
+    std::size_t const n_plys = 50;
+    std::size_t const n_ply_pnts = 6;
+
+    auto createGeometry = [&](GeoLib::GEOObjects& geo_objs,
+                              std::string& geo_name) {
+        auto pnts = std::make_unique<std::vector<GeoLib::Point*>>();
+        for (std::size_t i = 0; i < n_plys; ++i)
+        {
+            double x = coordinate(random_engine);
+            double y = coordinate(random_engine);
+            for (std::size_t k = 0; k < n_ply_pnts; ++k)
+            {
+                pnts->push_back(new GeoLib::Point(x, y, 0.0, pnts->size()));
+                x += step(random_engine);
+                y += step(random_engine);
+            }
+        }
+        geo_objs.addPointVec(std::move(pnts), geo_name);
+        auto const& pnt_vec = *geo_objs.getPointVec(geo_name);
+
+        auto plys = std::make_unique<std::vector<GeoLib::Polyline*>>();
+        for (std::size_t i = 0; i < n_plys; ++i)
+        {
+            auto* ply = new GeoLib::Polyline(pnt_vec);
+            for (std::size_t k = 0; k < n_ply_pnts; ++k)
+            {
+                ply->addPoint(i * n_ply_pnts + k);
+            }
+            plys->push_back(ply);
+        }
+        geo_objs.addPolylineVec(std::move(plys), geo_name);
+    };
+
+    std::string geo_name("TestGeometry");
+    GeoLib::GEOObjects geo_objs;
+    GeoLib::GEOObjects geo_objs_expected;
+    // Both geometries get the same points.
+    auto const state = random_engine;
+    createGeometry(geo_objs, geo_name);
+    random_engine = state;
+    createGeometry(geo_objs_expected, geo_name);
+
+    auto getPointVec = [&geo_name](GeoLib::GEOObjects& objs) -> auto& {
+        return *objs.getPointVecObj(geo_name);
+    };
+    auto getPolylines = [&geo_name](GeoLib::GEOObjects& objs) -> auto& {
+        return *const_cast<std::vector<GeoLib::Polyline*>*>(
+            objs.getPolylineVec(geo_name));
+    };
+
+    GeoLib::computeAndInsertAllIntersectionPoints(getPointVec(geo_objs),
+                                                  getPolylines(geo_objs));
+    computeAndInsertAllIntersectionPointsBruteForce(
+        getPointVec(geo_objs_expected), getPolylines(geo_objs_expected));
+
+    auto const& pnt_vec = getPointVec(geo_objs);
+    auto const& pnt_vec_expected = getPointVec(geo_objs_expected);
+    ASSERT_LT(n_plys * n_ply_pnts, pnt_vec_expected.size());
+    ASSERT_EQ(pnt_vec_expected.size(), pnt_vec.size());
+    for (std::size_t i = 0; i < pnt_vec.size(); ++i)
+    {
+        auto const& p = *(*pnt_vec.getVector())[i];
+        auto const& p_expected = *(*pnt_vec_expected.getVector())[i];
+        for (int c = 0; c < 3; ++c)
+        {
+            EXPECT_EQ(p_expected[c], p[c]);
+        }
+    }
+
+    auto const& plys = getPolylines(geo_objs);
+    auto const& plys_expected = getPolylines(geo_objs_expected);
+    for (std::size_t i = 0; i < n_plys; ++i)
+    {
+        ASSERT_EQ(plys_expected[i]->getNumberOfPoints(),
+                  plys[i]->getNumberOfPoints());
+        for (std::size_t k = 0; k < plys[i]->getNumberOfPoints(); ++k)
+        {
+            EXPECT_EQ(plys_expected[i]->getPointID(k), plys[i]->getPointID(k));
+        }
+    }
+}
@@ -126,6 +126,46 @@ TEST_F(PolygonTest, isPntInPolygonCheckOuterPoints)
         2.0+std::numeric_limits<float>::epsilon(),2.0,0.0)));
 }
 
+TEST_F(PolygonTest, arePntsInPolygonMatchesIsPntInPolygon)
+{
+    // regular grid over the enlarged bounding box of the polygon, the grid
+    // contains the polygon corners and points on horizontal and vertical
+    // edges
+    std::vector<GeoLib::Point> pnts;
+    for (int i = -30; i <= 30; ++i)
+    {
+        for (int j = -10; j <= 50; ++j)
+        {
+            pnts.emplace_back(0.1 * i, 0.1 * j, 0.0);
+        }
+    }
+    // points on the polygon edges
+    for (std::size_t k(0); k < _pnts.size(); k++)
+    {
+        GeoLib::Point const& a(*_pnts[k]);
+        GeoLib::Point const& b(*_pnts[(k + 1) % _pnts.size()]);
+        for (double t = 0; t < 1.0; t += 0.01)
+        {
+            pnts.emplace_back(a[0] + t * (b[0] - a[0]),
+                              a[1] + t * (b[1] - a[1]), 0.0);
+        }
+    }
+
+    std::vector<GeoLib::Point*> pnt_ptrs;
+    for (auto& p : pnts)
+    {
+        pnt_ptrs.push_back(&p);
+    }
+    std::vector<bool> const inside(_polygon->arePntsInPolygon(pnt_ptrs));
+
+    ASSERT_EQ(pnts.size(), inside.size());
+    for (std::size_t k(0); k < pnts.size(); k++)
+    {
+        EXPECT_EQ(_polygon->isPntInPolygon(pnts[k]), inside[k])
+            << "point " << k << ": " << pnts[k];
+    }
+}
+
 /**
  *  2     4     6
  *  |\   / \   /|
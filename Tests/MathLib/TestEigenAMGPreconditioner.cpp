@@ -0,0 +1,178 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#ifdef OGS_USE_EIGEN
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Eigen/IterativeLinearSolvers>
+
+#include "BaseLib/ConfigTree.h"
+#include "MathLib/LinAlg/Eigen/EigenAMGPreconditioner.h"
+#include "MathLib/LinAlg/Eigen/EigenLinearSolver.h"
+#include "MathLib/LinAlg/Eigen/EigenMatrix.h"
+#include "MathLib/LinAlg/Eigen/EigenVector.h"
+
+namespace
+{
+using Matrix = MathLib::EigenAMGPreconditioner::Matrix;
+
+/// Five point stencil of the operator \f$ -\nabla (k \nabla u) \f$ with
+/// Dirichlet boundary on a square grid of n x n points. The coefficient is
+/// one in the left half and k in the right half of the domain.
+Matrix laplace2D(int const n, double const k = 1)
+{
+    std::vector<Eigen::Triplet<double>> entries;
+    auto const id = [n](int const i, int const j) { return i + n * j; };
+    auto const coefficient = [n, k](int const i) { return i < n / 2 ? 1 : k; };
+    for (int j = 0; j < n; ++j)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            double diagonal = 0;
+            auto add_neighbour = [&](int const ni, int const nj) {
+                double const c =
+                    ni < 0 || ni >= n
+                        ? coefficient(i)
+                        : 0.5 * (coefficient(i) + coefficient(ni));
+                diagonal += c;
+                if (ni >= 0 && ni < n && nj >= 0 && nj < n)
+                {
+                    entries.emplace_back(id(i, j), id(ni, nj), -c);
+                }
+            };
+            add_neighbour(i - 1, j);
+            add_neighbour(i + 1, j);
+            add_neighbour(i, j - 1);
+            add_neighbour(i, j + 1);
+            entries.emplace_back(id(i, j), id(i, j), diagonal);
+        }
+    }
+    Matrix A(n * n, n * n);
+    A.setFromTriplets(entries.begin(), entries.end());
+    return A;
+}
+}  // namespace
+
+TEST(MathLibEigenAMGPreconditioner, BuildsHierarchy)
+{
+    MathLib::EigenAMGPreconditioner const amg(laplace2D(100));
+    ASSERT_EQ(Eigen::Success, amg.info());
+    EXPECT_LT(1u, amg.getNumberOfLevels());
+}
+
+TEST(MathLibEigenAMGPreconditioner, SmallMatrixIsSolvedDirectly)
+{
+    Matrix const A = laplace2D(10);
+    MathLib::EigenAMGPreconditioner const amg(A);
+    ASSERT_EQ(1u, amg.getNumberOfLevels());
+
+    Eigen::VectorXd const b = Eigen::VectorXd::Ones(A.rows());
+    Eigen::VectorXd const x = amg.solve(b);
+    EXPECT_NEAR(0, (A * x - b).norm(), 1e-12 * b.norm());
+}
+
+TEST(MathLibEigenAMGPreconditioner, LargeCoarsestLevelIsSmoothed)
+{
+    // Without off-diagonal entries nothing can be aggregated; the only level
+    // is too large for the direct solver and Gauss-Seidel is exact.
+    auto const n = 2 * MathLib::EigenAMGPreconditioner::max_coarse_size;
+    Matrix A(n, n);
+    A.setIdentity();
+    A *= 2;
+    MathLib::EigenAMGPreconditioner const amg(A);
+    ASSERT_EQ(Eigen::Success, amg.info());
+    ASSERT_EQ(1u, amg.getNumberOfLevels());
+
+    Eigen::VectorXd const b = Eigen::VectorXd::Ones(n);
+    Eigen::VectorXd const x = amg.solve(b);
+    EXPECT_NEAR(0, (A * x - b).norm(), 1e-12 * b.norm());
+}
+
+TEST(MathLibEigenAMGPreconditioner, ConjugateGradient)
+{
+    for (double const k : {1., 1e3})
+    {
+        Matrix const A = laplace2D(100, k);
+        Eigen::VectorXd const b = Eigen::VectorXd::Ones(A.rows());
+
+        Eigen::ConjugateGradient<Matrix, Eigen::Lower | Eigen::Upper,
+                                 Eigen::DiagonalPreconditioner<double>>
+            cg_jacobi;
+        cg_jacobi.setTolerance(1e-10);
+        cg_jacobi.compute(A);
+        cg_jacobi.solve(b).eval();
+        ASSERT_EQ(Eigen::Success, cg_jacobi.info());
+
+        Eigen::ConjugateGradient<Matrix, Eigen::Lower | Eigen::Upper,
+                                 MathLib::EigenAMGPreconditioner>
+            cg_amg;
+        cg_amg.setTolerance(1e-10);
+        cg_amg.compute(A);
+        Eigen::VectorXd const x_amg = cg_amg.solve(b);
+        ASSERT_EQ(Eigen::Success, cg_amg.info());
+
+        EXPECT_NEAR(0, (A * x_amg - b).norm(), 1e-9 * b.norm());
+        // The number of multigrid preconditioned iterations is independent
+        // of the mesh size, for this grid it is a fraction of the Jacobi
+        // preconditioned iterations.
+        EXPECT_LT(4 * cg_amg.iterations(), cg_jacobi.iterations());
+    }
+}
+
+TEST(MathLibEigenAMGPreconditioner, BiCGSTAB)
+{
+    Matrix const A = laplace2D(100, 1e2);
+    Eigen::VectorXd const b = Eigen::VectorXd::Ones(A.rows());
+
+    Eigen::BiCGSTAB<Matrix, MathLib::EigenAMGPreconditioner> bicgstab;
+    bicgstab.setTolerance(1e-10);
+    bicgstab.compute(A);
+    Eigen::VectorXd const x = bicgstab.solve(b);
+    ASSERT_EQ(Eigen::Success, bicgstab.info());
+    EXPECT_NEAR(0, (A * x - b).norm(), 1e-9 * b.norm());
+}
+
+TEST(MathLibEigenAMGPreconditioner, EigenLinearSolver)
+{
+    int const n = 50;
+    Matrix const A = laplace2D(n, 10);
+
+    boost::property_tree::ptree t_root;
+    boost::property_tree::ptree t_solver;
+    t_solver.put("solver_type", "CG");
+    t_solver.put("precon_type", "AMG");
+    t_solver.put("error_tolerance", 1e-12);
+    t_solver.put("max_iteration_step", 100);
+    t_root.put_child("eigen", t_solver);
+    BaseLib::ConfigTree conf(t_root, "", BaseLib::ConfigTree::onerror,
+                             BaseLib::ConfigTree::onwarning);
+    MathLib::EigenLinearSolver ls("", &conf);
+
+    // The second solve has slightly changed matrix entries and reuses the
+    // hierarchy of the first one; the solution must still be exact.
+    for (double const scaling : {1., 1.01})
+    {
+        MathLib::EigenMatrix A_ogs(A.rows());
+        A_ogs.getRawMatrix() = scaling * A;
+        MathLib::EigenVector b(A.rows());
+        MathLib::EigenVector x(A.rows());
+        b.getRawVector().setOnes();
+        x.setZero();
+        ASSERT_TRUE(ls.solve(A_ogs, b, x));
+        EXPECT_NEAR(
+            0,
+            (A_ogs.getRawMatrix() * x.getRawVector() - b.getRawVector()).norm(),
+            1e-10 * n);
+    }
+}
+
+#endif  // OGS_USE_EIGEN
@@ -13,6 +13,8 @@
  *
  */
 
+#include <cmath>
+
 #include <gtest/gtest.h>
 
 #include "MathLib/LinAlg/LinAlg.h"
@@ -241,6 +243,109 @@ TEST(Math, CheckInterface_Eigen)
 }
 #endif
 
+#ifdef OGS_USE_EIGEN
+TEST(Math, CheckInterface_Eigen_EliminatePinnedDofs)
+{
+    using IntType = MathLib::EigenMatrix::IndexType;
+
+    for (auto const* solver_type : {"CG", "SparseLU"})
+    {
+        boost::property_tree::ptree t_root;
+        boost::property_tree::ptree t_solver;
+        t_solver.put("solver_type", solver_type);
+        t_solver.put("precon_type", "NONE");
+        t_solver.put("error_tolerance", 1e-15);
+        t_solver.put("max_iteration_step", 1000);
+        t_solver.put("eliminate_pinned_dofs", true);
+        t_root.put_child("eigen", t_solver);
+        BaseLib::ConfigTree conf(t_root, "", BaseLib::ConfigTree::onerror,
+                                 BaseLib::ConfigTree::onwarning);
+
+        MathLib::EigenMatrix A(Example1<IntType>::dim_eqs);
+        checkLinearSolverInterface<MathLib::EigenMatrix, MathLib::EigenVector,
+                                   MathLib::EigenLinearSolver, IntType>(A,
+                                                                        conf);
+    }
+}
+#endif
+
+#ifdef OGS_USE_EIGEN
+TEST(Math, CheckInterface_Eigen_ReuseFactorization)
+{
+    using IntType = MathLib::EigenMatrix::IndexType;
+    IntType const n = 10;
+
+    // Symmetric positive definite tridiagonal matrix.
+    auto assemble = [n](MathLib::EigenMatrix& A, double const diagonal) {
+        for (IntType i = 0; i < n; ++i)
+        {
+            A.setValue(i, i, diagonal);
+            if (i > 0)
+            {
+                A.setValue(i, i - 1, -1.0);
+                A.setValue(i - 1, i, -1.0);
+            }
+        }
+        MathLib::finalizeMatrixAssembly(A);
+    };
+
+    auto check_solution = [n](MathLib::EigenMatrix& A,
+                              MathLib::EigenVector const& b,
+                              MathLib::EigenVector const& x) {
+        Eigen::VectorXd const r =
+            A.getRawMatrix() * x.getRawVector() - b.getRawVector();
+        EXPECT_NEAR(0.0, r.norm(), 1e-10 * n);
+    };
+
+    for (auto const* solver_type : {"CG", "SparseLU"})
+    {
+        boost::property_tree::ptree t_root;
+        boost::property_tree::ptree t_solver;
+        t_solver.put("solver_type", solver_type);
+        t_solver.put("precon_type", "DIAGONAL");
+        t_solver.put("error_tolerance", 1e-15);
+        t_solver.put("max_iteration_step", 1000);
+        t_solver.put("reuse_factorization", true);
+        t_root.put_child("eigen", t_solver);
+        BaseLib::ConfigTree conf(t_root, "", BaseLib::ConfigTree::onerror,
+                                 BaseLib::ConfigTree::onwarning);
+        MathLib::EigenLinearSolver ls("", &conf);
+
+        // Several right-hand sides for the same matrix, the second and third
+        // solves reuse the initialization of the first one.
+        for (int rhs = 0; rhs < 3; ++rhs)
+        {
+            MathLib::EigenMatrix A(n);
+            assemble(A, 4.0);
+            MathLib::EigenVector b(n);
+            MathLib::EigenVector x(n);
+            for (IntType i = 0; i < n; ++i)
+            {
+                b[i] = (rhs + 1) * std::sin(i + 1.0);
+            }
+            x.setZero();
+            ASSERT_TRUE(ls.solve(A, b, x));
+            check_solution(A, b, x);
+            EXPECT_EQ(1u, ls.getNumberOfInitializations());
+        }
+
+        // A changed matrix must not use the previous initialization.
+        MathLib::EigenMatrix A(n);
+        assemble(A, 3.0);
+        MathLib::EigenVector b(n);
+        MathLib::EigenVector x(n);
+        for (IntType i = 0; i < n; ++i)
+        {
+            b[i] = 1.0;
+        }
+        x.setZero();
+        ASSERT_TRUE(ls.solve(A, b, x));
+        check_solution(A, b, x);
+        EXPECT_EQ(2u, ls.getNumberOfInitializations());
+    }
+}
+#endif
+
 #if defined(OGS_USE_EIGEN) && defined(USE_LIS)
 TEST(Math, CheckInterface_EigenLis)
 {
@@ -0,0 +1,90 @@
+/**
+ * @copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/LICENSE.txt
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshEditing/Mesh2MeshPropertyInterpolation.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+
+namespace
+{
+void addConstantCellProperty(MeshLib::Mesh& mesh, std::string const& name,
+                             double const value)
+{
+    auto* const property =
+        mesh.getProperties().createNewPropertyVector<double>(
+            name, MeshLib::MeshItemType::Cell, 1);
+    property->resize(mesh.getNumberOfElements(), value);
+}
+
+void checkConstantCellProperty(MeshLib::Mesh const& mesh,
+                               std::string const& name, double const value)
+{
+    ASSERT_TRUE(mesh.getProperties().existsPropertyVector<double>(name));
+    auto const& property =
+        *mesh.getProperties().getPropertyVector<double>(name);
+    ASSERT_EQ(mesh.getNumberOfElements(), property.size());
+    for (auto const v : property)
+    {
+        EXPECT_NEAR(value, v, 1e-14);
+    }
+}
+}  // namespace
+
+TEST(MeshLib, Mesh2MeshPropertyInterpolation2D)
+{
+    std::unique_ptr<MeshLib::Mesh> src_mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 20));
+    addConstantCellProperty(*src_mesh, "permeability", 2.5e-12);
+    addConstantCellProperty(*src_mesh, "porosity", 0.2);
+
+    std::unique_ptr<MeshLib::Mesh> dest_mesh(
+        MeshLib::MeshGenerator::generateRegularTriMesh(1.0, 7));
+
+    MeshLib::Mesh2MeshPropertyInterpolation const interpolation(
+        *src_mesh, std::vector<std::string>{"permeability", "porosity"});
+    ASSERT_TRUE(interpolation.setPropertiesForMesh(*dest_mesh));
+
+    checkConstantCellProperty(*dest_mesh, "permeability", 2.5e-12);
+    checkConstantCellProperty(*dest_mesh, "porosity", 0.2);
+}
+
+TEST(MeshLib, Mesh2MeshPropertyInterpolation3D)
+{
+    std::unique_ptr<MeshLib::Mesh> src_mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 12));
+    addConstantCellProperty(*src_mesh, "porosity", 0.35);
+
+    std::unique_ptr<MeshLib::Mesh> dest_mesh(
+        MeshLib::MeshGenerator::generateRegularPrismMesh(1.0, 1.0, 1.0, 5, 5,
+                                                         5));
+
+    MeshLib::Mesh2MeshPropertyInterpolation const interpolation(*src_mesh,
+                                                                "porosity");
+    ASSERT_TRUE(interpolation.setPropertiesForMesh(*dest_mesh));
+
+    checkConstantCellProperty(*dest_mesh, "porosity", 0.35);
+}
+
+TEST(MeshLib, Mesh2MeshPropertyInterpolationDimensionMismatch)
+{
+    std::unique_ptr<MeshLib::Mesh> src_mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 2));
+    addConstantCellProperty(*src_mesh, "porosity", 0.35);
+    std::unique_ptr<MeshLib::Mesh> dest_mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 2));
+
+    MeshLib::Mesh2MeshPropertyInterpolation const interpolation(*src_mesh,
+                                                                "porosity");
+    ASSERT_FALSE(interpolation.setPropertiesForMesh(*dest_mesh));
+}
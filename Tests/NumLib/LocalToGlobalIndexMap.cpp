@@ -8,16 +8,21 @@
  */
 
 #include <memory>
+#include <numeric>
 #include <vector>
 
 #include <gtest/gtest.h>
 
+#include "NumLib/DOF/DOFTableUtil.h"
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
 #include "MeshLib/MeshGenerators/MeshGenerator.h"
 
 #include "MeshLib/Mesh.h"
 #include "MeshLib/MeshSearch/NodeSearch.h"
 #include "MeshLib/MeshSubset.h"
+#ifdef USE_PETSC
+#include "MeshLib/NodePartitionedMesh.h"
+#endif
 
 class NumLibLocalToGlobalIndexMapTest : public ::testing::Test
 {
@@ -26,6 +31,11 @@ public:
     NumLibLocalToGlobalIndexMapTest()
     {
         mesh.reset(MeshLib::MeshGenerator::generateLineMesh(1.0, mesh_size));
+#ifdef USE_PETSC
+        // The PETSc d.o.f. numbering needs a partitioned mesh. A single
+        // partition without ghost nodes is numbered like the serial mesh.
+        mesh = std::make_unique<MeshLib::NodePartitionedMesh>(*mesh);
+#endif
         nodesSubset =
             std::make_unique<MeshLib::MeshSubset>(*mesh, mesh->getNodes());
     }
@@ -179,6 +189,60 @@ TEST_F(NumLibLocalToGlobalIndexMapTest, DISABLED_MultipleVariablesMultipleCompon
     ASSERT_EQ(20, dof_map->getGlobalIndex(l_node0, 1, 0));
 }
 
+TEST_F(NumLibLocalToGlobalIndexMapTest, FieldSplitsByLocation)
+{
+    components.emplace_back(*nodesSubset);
+    dof_map = std::make_unique<NumLib::LocalToGlobalIndexMap>(
+        std::move(components), std::vector<int>{1, 2},
+        NumLib::ComponentOrder::BY_LOCATION);
+
+    auto const field_splits =
+        NumLib::computeFieldSplits(*dof_map, {"pressure", "displacement"});
+    ASSERT_EQ(2u, field_splits.size());
+
+    std::vector<GlobalIndexType> pressure_indices;
+    std::vector<GlobalIndexType> displacement_indices;
+    for (GlobalIndexType i = 0; i < 10; ++i)
+    {
+        pressure_indices.push_back(3 * i);
+        displacement_indices.push_back(3 * i + 1);
+        displacement_indices.push_back(3 * i + 2);
+    }
+    EXPECT_EQ("pressure", field_splits[0].name);
+    EXPECT_EQ(pressure_indices, field_splits[0].indices);
+    EXPECT_EQ(1, field_splits[0].block_size);
+    EXPECT_EQ("displacement", field_splits[1].name);
+    EXPECT_EQ(displacement_indices, field_splits[1].indices);
+    EXPECT_EQ(2, field_splits[1].block_size);
+    // The d.o.f.s of each node are numbered consecutively.
+    EXPECT_EQ(3, NumLib::computeInterleavedBlockSize(*dof_map));
+}
+
+// PETSc numbers the d.o.f.s by location only.
+#ifndef USE_PETSC
+TEST_F(NumLibLocalToGlobalIndexMapTest, FieldSplitsByComponent)
+#else
+TEST_F(NumLibLocalToGlobalIndexMapTest, DISABLED_FieldSplitsByComponent)
+#endif
+{
+    components.emplace_back(*nodesSubset);
+    dof_map = std::make_unique<NumLib::LocalToGlobalIndexMap>(
+        std::move(components), std::vector<int>{1, 2},
+        NumLib::ComponentOrder::BY_COMPONENT);
+
+    auto const field_splits =
+        NumLib::computeFieldSplits(*dof_map, {"pressure", "displacement"});
+    ASSERT_EQ(2u, field_splits.size());
+
+    std::vector<GlobalIndexType> displacement_indices(20);
+    std::iota(displacement_indices.begin(), displacement_indices.end(), 10);
+    EXPECT_EQ(10u, field_splits[0].indices.size());
+    EXPECT_EQ(displacement_indices, field_splits[1].indices);
+    // The components of a node are not consecutive.
+    EXPECT_EQ(1, field_splits[1].block_size);
+    EXPECT_EQ(1, NumLib::computeInterleavedBlockSize(*dof_map));
+}
+
 
 #ifndef USE_PETSC
 TEST_F(NumLibLocalToGlobalIndexMapTest, MultipleVariablesMultipleComponentsHeterogeneousElements)
@@ -283,3 +347,56 @@ TEST_F(NumLibLocalToGlobalIndexMapTest, DISABLED_MultipleVariablesMultipleCompon
     ASSERT_EQ(1u, ele1_c2_indices.rows.size());
     ASSERT_EQ(20u, ele1_c2_indices.rows[0]);
 }
+
+#ifndef USE_PETSC
+TEST_F(NumLibLocalToGlobalIndexMapTest, VariablePerElement)
+#else
+TEST_F(NumLibLocalToGlobalIndexMapTest, DISABLED_VariablePerElement)
+#endif
+{
+    // Like a field of borehole heat exchangers:
+    // - 1st variable with 2 components for all nodes, elements
+    // - for each element a variable with 1 component on its nodes
+    std::vector<int> vec_var_n_components{2};
+    std::vector<std::vector<MeshLib::Element*> const*> vec_var_elements{
+        &mesh->getElements()};
+    std::vector<std::vector<MeshLib::Node*>> element_nodes;
+    std::vector<std::vector<MeshLib::Element*>> element_vectors;
+    element_nodes.reserve(mesh_size);
+    element_vectors.reserve(mesh_size);
+    for (std::size_t e = 0; e < mesh_size; ++e)
+    {
+        auto* const element = const_cast<MeshLib::Element*>(mesh->getElement(e));
+        element_nodes.emplace_back(element->getNodes(),
+                                   element->getNodes() + 2);
+        element_vectors.push_back({element});
+        components.emplace_back(*mesh, element_nodes.back());
+        vec_var_n_components.push_back(1);
+        vec_var_elements.push_back(&element_vectors.back());
+    }
+
+    dof_map = std::make_unique<NumLib::LocalToGlobalIndexMap>(
+        std::move(components), vec_var_n_components, vec_var_elements,
+        NumLib::ComponentOrder::BY_COMPONENT);
+
+    ASSERT_EQ(2 + static_cast<int>(mesh_size),
+              dof_map->getNumberOfComponents());
+    for (std::size_t e = 0; e < mesh_size; ++e)
+    {
+        EXPECT_EQ(3u, dof_map->getNumberOfElementComponents(e));
+        EXPECT_EQ(6u, dof_map->getNumberOfElementDOF(e));
+        EXPECT_EQ((std::vector<int>{0, static_cast<int>(e) + 1}),
+                  dof_map->getElementVariableIDs(e));
+
+        // The indices are ordered by component.
+        std::vector<GlobalIndexType> expected;
+        for (int c = 0; c < dof_map->getNumberOfComponents(); ++c)
+        {
+            auto const& rows = (*dof_map)(e, c).rows;
+            expected.insert(expected.end(), rows.begin(), rows.end());
+        }
+        EXPECT_EQ(expected, NumLib::getIndices(e, *dof_map));
+        EXPECT_EQ(2u, (*dof_map)(e, 2 + e).rows.size());
+        EXPECT_EQ(0u, (*dof_map)(e, 2 + (e + 1) % mesh_size).rows.size());
+    }
+}
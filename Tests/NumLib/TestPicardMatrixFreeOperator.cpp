@@ -0,0 +1,197 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include "BaseLib/ConfigTree.h"
+#include "MathLib/LinAlg/ApplyKnownSolution.h"
+#include "MathLib/LinAlg/FinalizeMatrixAssembly.h"
+#include "MathLib/LinAlg/GlobalMatrixVectorTypes.h"
+#include "MathLib/LinAlg/LinAlg.h"
+#include "NumLib/ODESolver/PicardMatrixFreeOperator.h"
+
+#if defined(OGS_USE_EIGEN) && !defined(USE_PETSC)
+
+#include "MathLib/LinAlg/Eigen/EigenLinearSolver.h"
+#include "MathLib/LinAlg/Eigen/EigenMatrixFreeOperator.h"
+
+namespace
+{
+//! Applies an assembled matrix through the matrix-free interface.
+class AssembledMatrixFreeOperator final
+    : public MathLib::MatrixFreeOperator<GlobalVector>
+{
+public:
+    explicit AssembledMatrixFreeOperator(GlobalMatrix const& K) : _K(K) {}
+
+    void apply(GlobalVector const& x, GlobalVector& y) const override
+    {
+        MathLib::LinAlg::matMult(_K, x, y);
+    }
+
+    void getDiagonal(GlobalVector& d) const override
+    {
+        MathLib::LinAlg::getDiagonal(_K, d);
+    }
+
+private:
+    GlobalMatrix const& _K;
+};
+
+struct NumLibPicardMatrixFreeOperator : public ::testing::Test
+{
+    NumLibPicardMatrixFreeOperator() : A(n), K(n), A_plus_K(n), b(n)
+    {
+        // K is the stiffness matrix of a 1D diffusion problem, which is
+        // applied matrix-free. A holds the storage term and a Robin boundary
+        // condition at the last node, which stay assembled.
+        for (GlobalIndexType i = 0; i < n; ++i)
+        {
+            A.add(i, i, 0.5);
+            K.add(i, i, 2.0);
+            if (i > 0)
+            {
+                K.add(i, i - 1, -1.0);
+                K.add(i - 1, i, -1.0);
+            }
+            b[i] = std::sin(i + 1.0);
+        }
+        A.add(n - 1, n - 1, 3.0);
+        MathLib::finalizeMatrixAssembly(A);
+        MathLib::finalizeMatrixAssembly(K);
+
+        A_plus_K.getRawMatrix() = A.getRawMatrix() + K.getRawMatrix();
+        MathLib::finalizeMatrixAssembly(A_plus_K);
+    }
+
+    bool isKnown(GlobalIndexType const i) const
+    {
+        return std::find(known_ids.begin(), known_ids.end(), i) !=
+               known_ids.end();
+    }
+
+    static constexpr GlobalIndexType n = 10;
+    std::vector<GlobalIndexType> const known_ids{0, 4};
+    std::vector<double> const known_values{1.0, -0.5};
+
+    GlobalMatrix A;
+    GlobalMatrix K;
+    GlobalMatrix A_plus_K;
+    GlobalVector b;
+};
+
+constexpr GlobalIndexType NumLibPicardMatrixFreeOperator::n;
+}  // namespace
+
+// Compares the operator and the right-hand side with the assembled Picard
+// system, to which the Dirichlet conditions are applied by
+// applyKnownSolution(). The latter keeps the diagonal entries of the known
+// rows, whereas the matrix-free operator has identity rows there.
+TEST_F(NumLibPicardMatrixFreeOperator, CompareWithAssembledSystem)
+{
+    GlobalMatrix A_ref(A_plus_K);
+    GlobalVector b_ref(b);
+    GlobalVector x_ref(n);
+    MathLib::applyKnownSolution(A_ref, b_ref, x_ref, known_ids, known_values);
+
+    AssembledMatrixFreeOperator const K_matrix_free(K);
+    NumLib::PicardMatrixFreeOperator op(K_matrix_free);
+    GlobalVector rhs(b);
+    op.reset(A, std::vector<GlobalIndexType>(known_ids), known_values, rhs);
+
+    GlobalVector x(n);
+    for (GlobalIndexType i = 0; i < n; ++i)
+    {
+        x[i] = std::cos(2.0 * i);
+    }
+    GlobalVector y(n);
+    op.apply(x, y);
+    GlobalVector y_ref(n);
+    MathLib::LinAlg::matMult(A_ref, x, y_ref);
+
+    GlobalVector d(n);
+    op.getDiagonal(d);
+    GlobalVector d_ref(n);
+    MathLib::LinAlg::getDiagonal(A_ref, d_ref);
+
+    double const tol = 1e-14;
+    for (GlobalIndexType i = 0; i < n; ++i)
+    {
+        if (isKnown(i))
+        {
+            auto const k = std::distance(
+                known_ids.begin(),
+                std::find(known_ids.begin(), known_ids.end(), i));
+            EXPECT_EQ(known_values[k], rhs[i]);
+            EXPECT_EQ(x[i], y[i]);
+            EXPECT_EQ(1.0, d[i]);
+        }
+        else
+        {
+            EXPECT_NEAR(b_ref[i], rhs[i], tol);
+            EXPECT_NEAR(y_ref[i], y[i], tol);
+            EXPECT_NEAR(d_ref[i], d[i], tol);
+        }
+    }
+
+    // The Eigen adaptor of the operator yields the same product.
+    MathLib::EigenMatrixFreeOperator const op_eigen(op, n);
+    Eigen::VectorXd const y_eigen = op_eigen * x.getRawVector();
+    for (GlobalIndexType i = 0; i < n; ++i)
+    {
+        EXPECT_NEAR(y[i], y_eigen[i], tol);
+    }
+}
+
+// Solves the matrix-free system with the Eigen CG solver and the diagonal
+// preconditioner and compares the result with the direct solution of the
+// assembled system.
+TEST_F(NumLibPicardMatrixFreeOperator, SolveLikeAssembledSystem)
+{
+    GlobalMatrix A_ref(A_plus_K);
+    GlobalVector b_ref(b);
+    GlobalVector x_ref(n);
+    MathLib::applyKnownSolution(A_ref, b_ref, x_ref, known_ids, known_values);
+    x_ref.getRawVector() =
+        Eigen::SparseLU<GlobalMatrix::RawMatrixType>(A_ref.getRawMatrix())
+            .solve(b_ref.getRawVector());
+
+    AssembledMatrixFreeOperator const K_matrix_free(K);
+    NumLib::PicardMatrixFreeOperator op(K_matrix_free);
+    GlobalVector rhs(b);
+    op.reset(A, std::vector<GlobalIndexType>(known_ids), known_values, rhs);
+
+    boost::property_tree::ptree t_root;
+    boost::property_tree::ptree t_solver;
+    t_solver.put("solver_type", "CG");
+    t_solver.put("precon_type", "DIAGONAL");
+    t_solver.put("error_tolerance", 1e-14);
+    t_solver.put("max_iteration_step", 1000);
+    t_root.put_child("eigen", t_solver);
+    BaseLib::ConfigTree conf(t_root, "", BaseLib::ConfigTree::onerror,
+                             BaseLib::ConfigTree::onwarning);
+    MathLib::EigenLinearSolver linear_solver("", &conf);
+
+    GlobalVector x(n);
+    MathLib::LinAlg::set(x, 0.0);
+    ASSERT_TRUE(linear_solver.solve(op, rhs, x));
+
+    for (GlobalIndexType i = 0; i < n; ++i)
+    {
+        EXPECT_NEAR(x_ref[i], x[i], 1e-12);
+    }
+}
+
+#endif
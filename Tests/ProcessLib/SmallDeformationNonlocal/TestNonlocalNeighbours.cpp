@@ -0,0 +1,131 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2019, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Eigen>
+
+#include "ProcessLib/SmallDeformationNonlocal/NonlocalNeighbours.h"
+
+using namespace ProcessLib::SmallDeformationNonlocal;
+
+namespace
+{
+std::vector<Eigen::Vector3d> randomPoints(std::size_t const n,
+                                          Eigen::Vector3d const& extent)
+{
+    std::mt19937 random_engine(42);
+    std::uniform_real_distribution<double> distribution(0, 1);
+    std::vector<Eigen::Vector3d> points;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        points.emplace_back(extent[0] * distribution(random_engine),
+                            extent[1] * distribution(random_engine),
+                            extent[2] * distribution(random_engine));
+    }
+    return points;
+}
+
+void checkNeighbours(std::vector<Eigen::Vector3d> const& points,
+                     double const radius_squared)
+{
+    auto const neighbours = findNeighboursWithinRadius(points, radius_squared);
+    ASSERT_EQ(points.size() + 1, neighbours.row_offsets.size());
+
+    for (std::size_t k = 0; k < points.size(); ++k)
+    {
+        std::vector<std::size_t> expected_columns;
+        std::vector<double> expected_values;
+        for (std::size_t l = 0; l < points.size(); ++l)
+        {
+            double const distance2 = (points[l] - points[k]).squaredNorm();
+            if (distance2 < radius_squared)
+            {
+                expected_columns.push_back(l);
+                expected_values.push_back(distance2);
+            }
+        }
+
+        auto const begin = neighbours.row_offsets[k];
+        auto const end = neighbours.row_offsets[k + 1];
+        ASSERT_EQ(expected_columns,
+                  std::vector<std::size_t>(
+                      neighbours.columns.begin() + begin,
+                      neighbours.columns.begin() + end));
+        ASSERT_EQ(expected_values,
+                  std::vector<double>(neighbours.values.begin() + begin,
+                                      neighbours.values.begin() + end));
+    }
+}
+}  // namespace
+
+TEST(ProcessLibSmallDeformationNonlocal, NeighboursWithinRadius3D)
+{
+    checkNeighbours(randomPoints(500, {1, 2, 3}), 0.3 * 0.3);
+}
+
+TEST(ProcessLibSmallDeformationNonlocal, NeighboursWithinRadiusPlanar)
+{
+    checkNeighbours(randomPoints(500, {2, 1, 0}), 0.1 * 0.1);
+}
+
+TEST(ProcessLibSmallDeformationNonlocal, NeighboursWithinRadiusWideSpread)
+{
+    // The radius is small compared to the domain, which limits the number of
+    // grid cells.
+    auto points = randomPoints(100, {1e6, 1e6, 1e6});
+    auto const close_points = randomPoints(100, {1e-3, 1e-3, 1e-3});
+    points.insert(points.end(), close_points.begin(), close_points.end());
+    checkNeighbours(points, 1e-4 * 1e-4);
+}
+
+TEST(ProcessLibSmallDeformationNonlocal, NeighboursWithinZeroRadius)
+{
+    auto const points = randomPoints(10, {1, 1, 1});
+    auto const neighbours = findNeighboursWithinRadius(points, 0);
+    EXPECT_EQ(std::vector<std::size_t>(points.size() + 1, 0),
+              neighbours.row_offsets);
+    EXPECT_TRUE(neighbours.columns.empty());
+}
+
+TEST(ProcessLibSmallDeformationNonlocal, NeighboursWithinRadiusRestricted)
+{
+    // Two groups of points, which are close but separated, e.g. by a notch.
+    auto const points = randomPoints(200, {1, 1, 1});
+    auto const group = [&](std::size_t const k) { return points[k][0] < 0.5; };
+    double const radius_squared = 0.2 * 0.2;
+
+    auto const neighbours = findNeighboursWithinRadius(
+        points, radius_squared,
+        [&](std::size_t const k, std::size_t const l) {
+            return group(k) == group(l);
+        });
+    ASSERT_EQ(points.size() + 1, neighbours.row_offsets.size());
+
+    for (std::size_t k = 0; k < points.size(); ++k)
+    {
+        std::vector<std::size_t> expected_columns;
+        for (std::size_t l = 0; l < points.size(); ++l)
+        {
+            if (group(k) == group(l) &&
+                (points[l] - points[k]).squaredNorm() < radius_squared)
+            {
+                expected_columns.push_back(l);
+            }
+        }
+        ASSERT_EQ(expected_columns,
+                  std::vector<std::size_t>(
+                      neighbours.columns.begin() + neighbours.row_offsets[k],
+                      neighbours.columns.begin() +
+                          neighbours.row_offsets[k + 1]));
+    }
+}
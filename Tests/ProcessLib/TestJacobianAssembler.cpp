@@ -15,6 +15,7 @@
 #include "ProcessLib/LocalAssemblerInterface.h"
 #include "ProcessLib/AnalyticalJacobianAssembler.h"
 #include "ProcessLib/CentralDifferencesJacobianAssembler.h"
+#include "ProcessLib/ForwardDifferencesJacobianAssembler.h"
 
 //! Fills a vector with values whose absolute value is between \c abs_min and
 //! \c abs_max.
@@ -568,6 +569,72 @@ private:
     }
 };
 
+//! Compares the forward differences Jacobian with the analytical one. Forward
+//! differences are only first order accurate, hence the larger tolerance.
+template <class LocAsm>
+struct ProcessLibForwardDifferencesJacobianAssembler : public ::testing::Test
+{
+    static void test()
+    {
+        std::random_device rd;
+        std::mt19937 random_number_generator(rd());
+        std::uniform_int_distribution<std::size_t> rnd_size(3, 64);
+
+        // all components will be of order of magnitude one
+        std::vector<double> x(rnd_size(random_number_generator));
+        std::vector<double> xdot(x.size());
+        fillRandomlyConstrainedAbsoluteValues(x, 0.5, 1.5);
+        fillRandomlyConstrainedAbsoluteValues(xdot, 0.5, 1.5);
+
+        std::uniform_real_distribution<double> rnd;
+        double const dxdot_dx = rnd(random_number_generator);
+        double const dx_dx = rnd(random_number_generator);
+
+        ProcessLib::AnalyticalJacobianAssembler jac_asm_ana;
+        ProcessLib::ForwardDifferencesJacobianAssembler jac_asm_fd({1e-8});
+        LocAsm loc_asm;
+
+        std::vector<double> M_data_fd;
+        std::vector<double> K_data_fd;
+        std::vector<double> b_data_fd;
+        std::vector<double> Jac_data_fd;
+        std::vector<double> M_data_ana;
+        std::vector<double> K_data_ana;
+        std::vector<double> b_data_ana;
+        std::vector<double> Jac_data_ana;
+        double const t = 0.0;
+
+        jac_asm_fd.assembleWithJacobian(loc_asm, t, x, xdot, dxdot_dx, dx_dx,
+                                        M_data_fd, K_data_fd, b_data_fd,
+                                        Jac_data_fd);
+
+        jac_asm_ana.assembleWithJacobian(loc_asm, t, x, xdot, dxdot_dx, dx_dx,
+                                         M_data_ana, K_data_ana, b_data_ana,
+                                         Jac_data_ana);
+
+        // M, K and b stem from the unperturbed assembly.
+        double const eps = std::numeric_limits<double>::epsilon();
+        auto const expect_near = [eps](std::vector<double> const& expected,
+                                       std::vector<double> const& actual) {
+            ASSERT_EQ(expected.size(), actual.size());
+            for (std::size_t i = 0; i < expected.size(); ++i)
+            {
+                EXPECT_NEAR(expected[i], actual[i], eps);
+            }
+        };
+        expect_near(M_data_ana, M_data_fd);
+        expect_near(K_data_ana, K_data_fd);
+        expect_near(b_data_ana, b_data_fd);
+
+        ASSERT_EQ(x.size()*x.size(), Jac_data_fd.size());
+        ASSERT_EQ(x.size()*x.size(), Jac_data_ana.size());
+        for (std::size_t i=0; i<x.size()*x.size(); ++i) {
+            EXPECT_NEAR(Jac_data_ana[i], Jac_data_fd[i],
+                        5.0 * LocAsm::getTol());
+        }
+    }
+};
+
 using TestCases = ::testing::Types<
     // DiagX
     LocalAssemblerM<MatVecDiagX>, LocalAssemblerK<MatVecDiagX>,
@@ -594,3 +661,61 @@ TYPED_TEST(ProcessLibCentralDifferencesJacobianAssembler, Test)
 {
     TestFixture::test();
 }
+
+TYPED_TEST_CASE(ProcessLibForwardDifferencesJacobianAssembler, TestCases);
+
+TYPED_TEST(ProcessLibForwardDifferencesJacobianAssembler, Test)
+{
+    TestFixture::test();
+}
+
+//! Records the local solution of the last assemble() call.
+class LocalAssemblerRecordingX final : public ProcessLib::LocalAssemblerInterface
+{
+public:
+    void assemble(double const t, std::vector<double> const& local_x,
+                  std::vector<double>& local_M_data,
+                  std::vector<double>& local_K_data,
+                  std::vector<double>& local_b_data) override
+    {
+        _local_assembler.assemble(t, local_x, local_M_data, local_K_data,
+                                  local_b_data);
+        last_x = local_x;
+    }
+
+    std::vector<double> last_x;
+
+private:
+    LocalAssemblerMKb<MatVecXY, MatVecXY, MatVecXY> _local_assembler;
+};
+
+template <class NumericalJacobianAssembler>
+void testLastAssemblyIsUnperturbed()
+{
+    std::vector<double> const x{1.0, -0.5, 0.75, 1.25};
+    std::vector<double> const xdot{0.5, 1.0, -1.5, 0.25};
+
+    NumericalJacobianAssembler jac_asm({1e-8});
+    LocalAssemblerRecordingX loc_asm;
+
+    std::vector<double> M_data;
+    std::vector<double> K_data;
+    std::vector<double> b_data;
+    std::vector<double> Jac_data;
+    jac_asm.assembleWithJacobian(loc_asm, 0.0, x, xdot, 0.5, 1.0, M_data,
+                                 K_data, b_data, Jac_data);
+
+    ASSERT_EQ(x, loc_asm.last_x);
+}
+
+TEST(ProcessLibCentralDifferencesJacobianAssembler, LastAssemblyIsUnperturbed)
+{
+    testLastAssemblyIsUnperturbed<
+        ProcessLib::CentralDifferencesJacobianAssembler>();
+}
+
+TEST(ProcessLibForwardDifferencesJacobianAssembler, LastAssemblyIsUnperturbed)
+{
+    testLastAssemblyIsUnperturbed<
+        ProcessLib::ForwardDifferencesJacobianAssembler>();
+}
@@ -9,6 +9,21 @@ if(NOT OGS_MAX_ELEMENT_ORDER MATCHES "^[0-9]$")
 endif()
 add_definitions(-DOGS_MAX_ELEMENT_ORDER=${OGS_MAX_ELEMENT_ORDER})
 
+# The dimension of a mesh is the largest dimension of its elements, hence
+# processes are only built for global dimensions between OGS_MIN_GLOBAL_DIM and
+# OGS_MAX_ELEMENT_DIM.
+if(NOT OGS_MIN_GLOBAL_DIM MATCHES "^[1-3]$")
+  message(FATAL_ERROR "OGS_MIN_GLOBAL_DIM must be an integer between 1 and 3.")
+endif()
+if(OGS_MIN_GLOBAL_DIM GREATER OGS_MAX_ELEMENT_DIM)
+  message(FATAL_ERROR "OGS_MIN_GLOBAL_DIM must not be greater than OGS_MAX_ELEMENT_DIM.")
+endif()
+foreach(dim 1 2 3)
+  if(NOT dim LESS OGS_MIN_GLOBAL_DIM AND NOT dim GREATER OGS_MAX_ELEMENT_DIM)
+    add_definitions(-DOGS_ENABLE_GLOBAL_DIM_${dim})
+  endif()
+endforeach()
+
 
 if(OGS_ENABLE_ELEMENT_SIMPLEX)
     add_definitions(-DOGS_ENABLE_ELEMENT_SIMPLEX)